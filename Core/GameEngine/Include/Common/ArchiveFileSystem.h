@@ -86,6 +86,13 @@ typedef std::map<AsciiString, ArchivedDirectoryInfo> ArchivedDirectoryInfoMap; /
 typedef std::map<AsciiString, ArchivedFileInfo> ArchivedFileInfoMap; // Archived file name to archived file info
 typedef std::map<AsciiString, ArchiveFile *> ArchiveFileMap; // Archive file name to archive data
 typedef std::multimap<AsciiString, ArchiveFile *> ArchivedFileLocationMap; // Archived file name to archive data
+typedef std::vector<ArchiveFile *> ArchiveFileList;
+
+// Ronin @performance 16/10/2026 Flat index of full archived file paths, so that file lookups do not walk the directory tree.
+typedef std::hash_map<
+	rts::string_key<AsciiString>, ArchiveFileList,
+	rts::string_key_hash<AsciiString>,
+	rts::string_key_equal<AsciiString> > ArchivedFilePathMap; // Lowercase archived file path to the archives that contain it, in override order
 
 class ArchivedDirectoryInfo
 {
@@ -161,11 +168,14 @@ protected:
 	};
 
 	ArchivedDirectoryInfoResult getArchivedDirectoryInfo(const Char* directory);
+	const ArchiveFileList* findArchiveFileList(const Char* filePath) const; ///< return the archives that contain the file with this index key in override order, or null if there are none.
+	ArchiveFile* findArchiveFileInDirectoryTree(const Char* filename, FileInstance instance) const; ///< slow lookup for paths that are too long for the file path index.
 
 	virtual void loadIntoDirectoryTree(ArchiveFile *archiveFile, Bool overwrite = FALSE);	///< load the archive file's header information and apply it to the global archive directory tree.
 
 	ArchiveFileMap m_archiveFileMap;
 	ArchivedDirectoryInfo m_rootDirectory;
+	ArchivedFilePathMap m_filePathIndex;
 };
 
 
@@ -83,6 +83,8 @@
 #define PRESERVE_RETAIL_SCRIPTED_CAMERA (1) // Retain scripted camera behavior present in retail Generals 1.08 and Zero Hour 1.04
 #endif
 
+// Ronin @performance 16/10/2026 The hierarchical path cache of Pathfinder::findPath changes which cells are examined
+// and is only compiled when this is disabled, so the default build reports zero path cache hits and misses.
 #ifndef RETAIL_COMPATIBLE_CRC
 #define RETAIL_COMPATIBLE_CRC (1) // Game is expected to be CRC compatible with retail Generals 1.08, Zero Hour 1.04
 #endif
@@ -110,6 +112,19 @@
 #define RETAIL_COMPATIBLE_NETWORKING (1)
 #endif
 
+// Ronin @performance 16/10/2026 The sleepy update scheduler is a binary heap in retail. Modules that are due on the same
+// frame and phase are updated in an order that depends on the heap layout, so any other scheduler breaks CRC compatibility.
+// When disabled, a hierarchical timing wheel is used instead, which updates modules with equal priority in insertion order.
+#ifndef RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER
+#define RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER (RETAIL_COMPATIBLE_CRC)
+#endif
+
+// Ronin @performance 16/10/2026 Players keep an index of their objects by template and KindOf for the object count queries.
+// When enabled, every indexed query is also answered by walking all teams of the player, and any mismatch asserts.
+#ifndef VALIDATE_PLAYER_OBJECT_INDEX
+#define VALIDATE_PLAYER_OBJECT_INDEX (0)
+#endif
+
 // This is essentially synonymous for RETAIL_COMPATIBLE_CRC. There is a lot wrong with AIGroup, such as use-after-free, double-free, leaks,
 // but we cannot touch it much without breaking retail compatibility. Do not shy away from using massive hacks when fixing issues with AIGroup,
 // but put them behind this macro.
@@ -176,6 +176,13 @@
 
 #endif // MEMORYPOOL_DEBUG
 
+// Ronin @performance 16/10/2026 Without memory pool debugging, each thread caches a small magazine of
+// free blocks per pool, so that most allocations and frees do not take the memory pool critical section.
+// The debugging builds keep allocating every block under the lock so that their per block tracking is exact.
+#if !defined(MEMORYPOOL_DEBUG) && !defined(MEMORYPOOL_MAGAZINES) && !defined(DISABLE_MEMORYPOOL_MAGAZINES) && !defined(DISABLE_GAMEMEMORY)
+	#define MEMORYPOOL_MAGAZINES
+#endif
+
 // TheSuperHackers @build xezon 30/03/2025 Define DISABLE_GAMEMEMORY to use a null implementations for Game Memory.
 // Useful for address sanitizer checks and other investigations.
 // Is included below the macros so that memory pool debug code can still be used.
@@ -223,6 +230,9 @@ class MemoryPool;
 class MemoryPoolFactory;
 class DynamicMemoryAllocator;
 class BlockCheckpointInfo;
+#ifdef MEMORYPOOL_MAGAZINES
+struct MemoryPoolMagazine;
+#endif
 
 // TYPE DEFINES ///////////////////////////////////////////////////////////////
 
@@ -306,6 +316,10 @@ private:
 	MemoryPoolBlob		*m_firstBlob;								///< head of linked list: first blob for this pool.
 	MemoryPoolBlob		*m_lastBlob;								///< tail of linked list: last blob for this pool. (needed for efficiency)
 	MemoryPoolBlob		*m_firstBlobWithFreeBlocks;	///< first blob in this pool that has at least one unallocated block.
+#ifdef MEMORYPOOL_MAGAZINES
+	Int								m_magazineSlot;							///< index of this pool in the thread magazine tables, or -1 if it does not use magazines
+	Int								m_magazineEpoch;						///< renewed whenever the blobs of this pool are thrown away, which empties all magazines
+#endif
 
 private:
 	/// create a new blob with the given number of blocks.
@@ -314,6 +328,25 @@ private:
 	/// destroy a blob.
 	Int freeBlob(MemoryPoolBlob *blob);
 
+	/// take a block from the blobs. the caller must hold the memory pool critical section.
+	MemoryPoolSingleBlock *allocateSingleBlockLocked(DECLARE_LITERALSTRING_ARG1);
+
+	/// return a block to its blob. the caller must hold the memory pool critical section.
+	void freeSingleBlockLocked(MemoryPoolSingleBlock *block);
+
+#ifdef MEMORYPOOL_MAGAZINES
+	/// return the magazine of the calling thread for this pool, or null if this pool does not use magazines.
+	MemoryPoolMagazine *getThreadMagazine();
+
+	/// move a batch of blocks from the blobs into the given empty magazine.
+	void refillMagazine(MemoryPoolMagazine *magazine);
+
+	/// return blocks from the given magazine to the blobs until keepCount blocks are left.
+	void flushMagazine(MemoryPoolMagazine *magazine, Int keepCount);
+
+	friend void releaseThreadMemoryPoolMagazines();
+#endif
+
 public:
 
 	// 'public' funcs that are really only for use by MemoryPoolFactory
@@ -360,7 +393,7 @@ public:
 	/// return the number of free (available) blocks in this pool.
 	Int getFreeBlockCount();
 
-	/// return the number of blocks in use in this pool.
+	/// return the number of blocks in use in this pool. blocks cached in thread magazines count as used.
 	Int getUsedBlockCount();
 
 	/// return the total number of blocks in this pool. [ == getFreeBlockCount() + getUsedBlockCount() ]
@@ -817,6 +850,15 @@ extern Bool isMemoryManagerOfficiallyInited();
 */
 extern void shutdownMemoryManager();
 
+#ifdef MEMORYPOOL_MAGAZINES
+/**
+	Return the free blocks cached by the calling thread to their pools. Threads that allocate
+	from memory pools should call this before they exit, otherwise their cached blocks stay
+	allocated until their pools are reset.
+*/
+extern void releaseThreadMemoryPoolMagazines();
+#endif
+
 extern MemoryPoolFactory *TheMemoryPoolFactory;
 extern DynamicMemoryAllocator *TheDynamicMemoryAllocator;
 
@@ -35,4 +35,13 @@ extern void InitRandom( UnsignedInt seed );
 extern UnsignedInt GetGameLogicRandomSeed();   ///< Get the seed (used for replays)
 extern UnsignedInt GetGameLogicRandomSeedCRC();///< Get the seed (used for CRCs)
 
+// The complete state of the logic random number generator. It is not part of save games.
+struct GameLogicRandomState
+{
+	UnsignedInt seed[6];
+	UnsignedInt baseSeed;
+};
+extern void GetGameLogicRandomState( GameLogicRandomState *state );				///< Get the logic random state (used for replay snapshots)
+extern void SetGameLogicRandomState( const GameLogicRandomState *state );	///< Restore the logic random state (used for replay snapshots)
+
 //--------------------------------------------------------------------------------------------------------------
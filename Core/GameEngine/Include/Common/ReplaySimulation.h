@@ -37,7 +37,8 @@ public:
 private:
 
 	static int simulateReplaysInThisProcess(const std::vector<AsciiString> &filenames);
-	static int simulateReplaysInWorkerProcesses(const std::vector<AsciiString> &filenames, int maxProcesses);
+	static int simulateReplaySeekBenchmark(const std::vector<AsciiString> &filenames);
+	static int simulateReplaysInWorkerProcesses(const std::vector<AsciiString> &filenames, int maxProcesses, int replaysPerProcess);
 	static std::vector<AsciiString> resolveFilenameWildcards(const std::vector<AsciiString> &filenames);
 
 private:
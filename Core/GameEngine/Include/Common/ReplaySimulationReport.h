@@ -0,0 +1,115 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// Ronin @feature 16/10/2026
+// Machine readable per replay results of a headless replay simulation.
+// The report is written as JSON, or as CSV if the report filename ends with ".csv".
+// If the report filename is "-", each entry is printed to stdout as a single line instead,
+// which is how worker processes hand their results to the parent process.
+class ReplaySimulationReport
+{
+public:
+	enum ReplayResult CPP_11(: Int)
+	{
+		REPLAY_RESULT_SUCCESS,
+		REPLAY_RESULT_MISMATCH,
+		REPLAY_RESULT_ERROR,
+
+		REPLAY_RESULT_COUNT
+	};
+
+	struct Entry
+	{
+		Entry();
+
+		AsciiString filename;
+		ReplayResult result;
+		Int mismatchFrame;								///< First frame with a CRC mismatch, or -1
+		UnsignedInt frameCount;						///< Number of simulated logic frames
+		UnsignedInt wallTimeMsec;					///< Wall time of the whole simulation including the map load
+		Real logicFramesPerSecond;				///< Simulated logic frames per second of wall time spent in frames
+		Real frameTimeP50Msec;
+		Real frameTimeP99Msec;
+		Real frameTimeMaxMsec;
+		UnsignedInt peakObjectCount;
+		UnsignedInt peakPathfindQueueLength;	///< Peak number of objects in the pathfind queue
+		Int peakWaitingForPath;						///< Peak number of AI objects waiting for a path, or -1 if not available in this build
+		Int failedPathfinds;							///< Failed pathfinds at the end of the replay, or -1 if not available in this build
+		UnsignedInt pathfindPaths;				///< Paths computed by the pathfind queue
+		UnsignedInt pathfindCells;				///< Cells examined by the pathfind queue
+		Real pathfindTimeMsec;						///< Wall time spent in the pathfind queue
+		UnsignedInt pathCacheHits;				///< Hierarchical path searches served from the cache, always 0 with RETAIL_COMPATIBLE_CRC
+		UnsignedInt pathCacheMisses;			///< Hierarchical path searches that were cacheable but not cached yet
+		UnsignedInt pathCacheCellsSaved;	///< Cells the cache hits did not need to examine again
+		Real clientTimeMsec;							///< Wall time spent in the client update with the null display
+		Real logicTimeMsec;								///< Wall time spent in logic frames
+		Real overlapTimeMsec;							///< Sum of the shorter of client and logic update per frame, which running them concurrently could hide
+		UnsignedInt areaDamageDetonations;	///< WeaponTemplate::dealDamageInternal calls, including those that hit no object
+		UnsignedInt areaDamageVictims;		///< Objects damaged by weapon detonations
+		Real areaDamageTimeMsec;					///< Wall time spent dealing weapon damage
+	};
+
+	// Collects the statistics of a single replay while it is being simulated.
+	class Collector
+	{
+	public:
+		Collector();
+
+		void begin(const AsciiString &filename);
+		void beginClientUpdate();
+		void endClientUpdate();
+		void beginFrame();
+		void endFrame();
+		void finish(ReplayResult result, Int mismatchFrame, Entry &entry);
+
+	private:
+		Real getElapsedMsec(Int64 start, Int64 end) const;
+
+		AsciiString m_filename;
+		std::vector<Real> m_frameTimesMsec;
+		Int64 m_freq;
+		Int64 m_startTime;
+		Int64 m_frameStartTime;
+		Int64 m_clientStartTime;
+		Real m_clientTimeMsec;						///< Client update time of the current frame
+		Real m_totalClientTimeMsec;
+		Real m_totalOverlapTimeMsec;
+		UnsignedInt m_peakObjectCount;
+		UnsignedInt m_peakPathfindQueueLength;
+		Int m_peakWaitingForPath;
+	};
+
+	static Bool isStdOutput(const AsciiString &reportFilename);
+
+	void addEntry(const Entry &entry);
+	Int getEntryCount() const { return (Int)m_entries.size(); }
+	const Entry &getEntry(Int index) const { return m_entries[index]; }
+
+	Bool writeFile(const AsciiString &reportFilename) const;
+
+	static void printEntryLine(const Entry &entry);
+	static Bool parseEntryLine(const char *line, Entry &entry); ///< Returns true if the line was printed by printEntryLine
+
+private:
+	void writeJson(FILE *fp) const;
+	void writeCsv(FILE *fp) const;
+
+	std::vector<Entry> m_entries;
+};
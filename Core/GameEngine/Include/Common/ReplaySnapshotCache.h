@@ -0,0 +1,70 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Common/RandomValue.h"
+#include "Common/Recorder.h"
+
+// Ronin @feature 16/10/2026
+// Keeps in-memory snapshots of the logic state during replay playback, taken every N logic frames
+// through the save game machinery. A seek restores the nearest earlier snapshot and then only
+// simulates the remaining frames instead of simulating the replay from frame 0.
+// Note that the save game does not capture every bit of logic state, so the simulation after a
+// restore is not guaranteed to match the original CRCs. Seeking is meant for viewing and analysis.
+class ReplaySnapshotCache
+{
+public:
+	ReplaySnapshotCache();
+	~ReplaySnapshotCache();
+
+	void setInterval(UnsignedInt frames) { m_interval = frames; }
+	UnsignedInt getInterval() const { return m_interval; }
+
+	void clear();
+
+	// Call this in between two logic frames during playback. Takes a snapshot every interval frames.
+	void update();
+
+	// Move the playback to the given frame. Restores the nearest snapshot at or before the frame if
+	// the frame is not ahead of the current frame, then simulates the remaining frames headless.
+	// Returns true if the playback reached the frame.
+	Bool seek(UnsignedInt frame);
+
+	UnsignedInt getSnapshotCount() const { return (UnsignedInt)m_snapshots.size(); }
+	size_t getMemoryUsage() const;
+	Int getLastRestoredFrame() const { return m_lastRestoredFrame; } ///< Frame of the snapshot restored by the last seek, or -1
+
+private:
+	struct ReplaySnapshot
+	{
+		UnsignedInt frame;
+		std::vector<UnsignedByte> gameState;
+		RecorderClass::PlaybackState playbackState;
+		GameLogicRandomState randomState;
+	};
+
+	Bool takeSnapshot();
+	Bool restoreSnapshot(const ReplaySnapshot &snapshot);
+	const ReplaySnapshot *findSnapshot(UnsignedInt frame) const; ///< Nearest snapshot at or before the frame
+
+	std::vector<ReplaySnapshot *> m_snapshots; ///< Sorted by frame
+	AsciiString m_replayFilename;
+	UnsignedInt m_interval;
+	Int m_lastRestoredFrame;
+};
@@ -0,0 +1,54 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: XferLoadBuffer.h /////////////////////////////////////////////////////////////////////////
+// Desc:   Xfer memory buffer read implementation
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// USER INCLUDES //////////////////////////////////////////////////////////////////////////////////
+#include "Common/XferLoad.h"
+
+//-------------------------------------------------------------------------------------------------
+/** Reads data written by XferSaveBuffer, or the contents of a save file, from a memory buffer.
+	* The buffer is not copied and must stay alive until the xfer is closed. */
+//-------------------------------------------------------------------------------------------------
+class XferLoadBuffer : public XferLoad
+{
+
+public:
+
+	XferLoadBuffer( const UnsignedByte *data, Int dataSize );
+	virtual ~XferLoadBuffer() override;
+
+	virtual void open( AsciiString identifier ) override;				///< start reading at the beginning of the buffer
+	virtual void close() override;													///< finish reading
+	virtual Int beginBlock() override;														///< read block size
+	virtual void skip( Int dataSize ) override;									///< skip forward dataSize bytes
+
+protected:
+
+	virtual void xferImplementation( void *data, Int dataSize ) override;		///< the xfer implementation
+
+	const UnsignedByte *m_data;																///< the data to read
+	Int m_dataSize;
+	Int m_position;																						///< current read position
+	Bool m_isOpen;
+
+};
@@ -0,0 +1,58 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: XferSaveBuffer.h /////////////////////////////////////////////////////////////////////////
+// Desc:   Xfer memory buffer write implementation
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// USER INCLUDES //////////////////////////////////////////////////////////////////////////////////
+#include "Common/XferSave.h"
+
+//-------------------------------------------------------------------------------------------------
+/** Writes the exact same data as XferSave, but into a memory buffer instead of a file.
+	* The buffer can be read back with XferLoadBuffer. */
+//-------------------------------------------------------------------------------------------------
+class XferSaveBuffer : public XferSave
+{
+
+public:
+
+	XferSaveBuffer();
+	virtual ~XferSaveBuffer() override;
+
+	// Xfer methods
+	virtual void open( AsciiString identifier ) override;		///< start writing into an empty buffer
+	virtual void close() override;											///< finish writing
+	virtual Int beginBlock() override;									///< write placeholder block size
+	virtual void endBlock() override;									///< write size of the last begun block
+	virtual void skip( Int dataSize ) override;							///< write dataSize zero bytes
+
+	const std::vector<UnsignedByte> &getBuffer() const { return m_buffer; }
+	void swapBuffer( std::vector<UnsignedByte> &buffer ) { m_buffer.swap( buffer ); }	///< take the written data without a copy
+
+protected:
+
+	virtual void xferImplementation( void *data, Int dataSize ) override;		///< the xfer implementation
+
+	std::vector<UnsignedByte> m_buffer;												///< the written data
+	std::vector<Int> m_blockPositions;												///< stack of begun block positions
+	Bool m_isOpen;
+
+};
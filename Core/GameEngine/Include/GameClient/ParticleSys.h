@@ -45,6 +45,7 @@
 class Particle;
 class ParticleSystem;
 class ParticleSystemManager;
+class ParticleUpdateThreadClass;
 class Drawable;
 class Object;
 struct FieldParse;
@@ -164,6 +165,22 @@ protected:
 };
 
 
+/**
+ * Values that are the same for every particle of a ParticleSystem during one update.
+ * ParticleSystem::update gathers them once, instead of each particle asking its system again.
+ */
+struct ParticleUpdateContext
+{
+	Coord3D						m_driftVelocity;				///< drift velocity of the system
+	Real							m_gravity;							///< downward acceleration of the system
+	UnsignedInt				m_frame;								///< current client frame
+	Bool							m_updateAlpha;					///< alpha is not used by additive systems
+	Bool							m_useWind;							///< the system has wind motion
+	Coord3D						m_windOrigin;						///< world position the wind strength is measured from
+	Real							m_windCos;							///< cosine of the wind angle
+	Real							m_windSin;							///< sine of the wind angle
+};
+
 /**
  * An individual particle created by a ParticleSystem.
  * NOTE: Particles cannot exist without a parent particle system.
@@ -178,8 +195,8 @@ public:
 
 	Particle( ParticleSystem *system, const ParticleInfo *data );
 
-	Bool update();												///< update this particle's behavior - return false if dead
-	void doWindMotion();									///< do wind motion (if present) from particle system
+	Bool update( const ParticleUpdateContext &context );	///< update this particle's behavior - return false if dead
+	void doWindMotion( const ParticleUpdateContext &context );	///< do wind motion (if present) from particle system
 
 	void applyForce( const Coord3D *force );		///< add the given acceleration
 
@@ -578,6 +595,8 @@ public:
 
 	virtual Bool update( Int localPlayerIndex );								///< update this particle system, return false if dead
 	void updateWindMotion();							///< update wind motion
+	void computeParticleUpdateContext( ParticleUpdateContext *context );	///< gather the per update values shared by all our particles
+	void updateParticles( const ParticleUpdateContext &context );	///< update all our particles, destroying the ones that died
 
 	void setControlParticle( Particle *p );			///< set control particle
 
@@ -809,6 +828,12 @@ public:
 	void friend_addParticleSystem( ParticleSystem *particleSystemToAdd );
 	void friend_removeParticleSystem( ParticleSystem *particleSystemToRemove );
 
+	/// update the particles of one system on the update threads, returns FALSE if the caller must update them itself
+	Bool friend_updateParticlesOnThreads( Particle *firstParticle, Int particleCount, const ParticleUpdateContext &context );
+
+	Int getUpdateThreadCount() const { return (Int)m_updateThreads.size(); }	///< number of worker threads helping with the particle update
+	Real getUpdateTimeLastFrame() const { return m_updateTimeLastFrame; }	///< time update() took last frame, in seconds
+
 protected:
 
 	// snapshot methods
@@ -831,8 +856,18 @@ protected:
 	Int m_localPlayerIndex;	///<used to tell particle systems which particles can be skipped due to player shroud status
 
 private:
+	void startUpdateThreads();
+	void stopUpdateThreads();
+
 	TemplateMap m_templateMap;		///< a hash map of all particle system templates
 	ParticleSystemIDMap m_systemMap; ///< a hash map of all particle systems
+
+	// Ronin @performance 16/10/2026 Particles of large systems are updated in slices on worker threads.
+	typedef std::vector<ParticleUpdateThreadClass*> UpdateThreadVec;
+	UpdateThreadVec m_updateThreads;							///< workers, as many as GlobalData::m_particleUpdateThreads asks for
+	std::vector<Particle*> m_updateParticles;			///< particles of the system that is being updated on the workers
+	std::vector<UnsignedByte> m_updateParticleAlive;	///< result of the update of each particle in m_updateParticles
+	Real m_updateTimeLastFrame;										///< time update() took last frame, in seconds
 };
 
 // TheSuperHackers @feature bobtista 31/01/2026
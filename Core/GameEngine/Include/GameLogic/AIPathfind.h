@@ -224,6 +224,7 @@ protected:
 
 
 	PathfindCellInfo *m_nextOpen, *m_prevOpen;						///< for A* "open" list, shared by closed list
+	Int m_openHeapIndex;																	///< index into the open list heap, or -1 if not in the heap
 
 	PathfindCellInfo *m_pathParent;												///< "parent" cell from pathfinder
 	PathfindCell *m_cell;															///< Cell this info belongs to currently.
@@ -249,28 +250,47 @@ protected:
 };
 
 // TheSuperHackers @info The PathfindCellList class acts as a new management class for the pathfindcell open and closed lists
+// Ronin @performance 16/10/2026 The fixed pathfinding keeps the open list in a binary heap instead of a sorted linked list.
+// The heap entries carry their own sort key, so comparisons stay within the heap array and do not touch the cell infos.
+// Entries of equal cost are ordered by insertion, which pops cells in the same order as the stable insertion sort did.
+// The retail compatible pathfinding and the closed list still use the linked list through m_head.
 class PathfindCellList
 {
 	friend class PathfindCell;
 
 public:
-	PathfindCellList() : m_head(nullptr), m_tail(nullptr) {}
+	PathfindCellList() : m_head(nullptr), m_nextOpenOrder(0) {}
 
 #if RETAIL_COMPATIBLE_PATHFINDING
-	void reset(PathfindCell* newHead = nullptr) { m_head = newHead; m_tail = nullptr; }
+	void reset(PathfindCell* newHead = nullptr) { m_head = newHead; m_heap.clear(); m_nextOpenOrder = 0; }
 #else
-	void reset() { m_head = nullptr; m_tail = nullptr; }
+	void reset() { m_head = nullptr; m_heap.clear(); m_nextOpenOrder = 0; }
 #endif
 
-	PathfindCell* getHead() const { return m_head; }
+	PathfindCell* getHead() const { return m_heap.empty() ? m_head : m_heap.front().m_cell; }
 
-	Bool empty() const { return m_head == nullptr; }
+	Bool empty() const { return m_head == nullptr && m_heap.empty(); }
 
-	Bool canReverseSort(PathfindCell& currentCell) const;
+	PathfindCell* getNext(PathfindCell* cell) const; ///< Next cell in list or heap order, for iterating all cells in the list
 
 private:
+	struct OpenHeapEntry
+	{
+		UnsignedShort m_totalCost;
+		UnsignedInt m_order;
+		PathfindCell* m_cell;
+
+		Bool operator<(const OpenHeapEntry& other) const
+		{
+			if (m_totalCost != other.m_totalCost)
+				return m_totalCost < other.m_totalCost;
+			return m_order < other.m_order;
+		}
+	};
+
 	PathfindCell* m_head;
-	PathfindCell* m_tail;
+	std::vector<OpenHeapEntry> m_heap;
+	UnsignedInt m_nextOpenOrder;
 };
 
 /**
@@ -338,11 +358,11 @@ public:
 	void forwardInsertionSortRetailCompatible(PathfindCellList& list);
 #endif
 
-	// Forward insertion sort, in ascending cost order
-	void forwardInsertionSort(PathfindCellList& list);
-
-	// Reverse insertion sort, in ascending cost order
-	void reverseInsertionSort(PathfindCellList& list);
+	// Binary heap operations for the open list, in ascending cost order
+	void pushOnOpenHeap(PathfindCellList& list);
+	void removeFromOpenHeap(PathfindCellList& list);
+	static void siftUpOpenHeap(PathfindCellList& list, Int index);
+	static void siftDownOpenHeap(PathfindCellList& list, Int index);
 
 	/// put self on "open" list in ascending cost order
 	void putOnSortedOpenList( PathfindCellList &list );
@@ -364,6 +384,7 @@ public:
 
 	inline PathfindCell *getNextOpen() {return m_info->m_nextOpen?m_info->m_nextOpen->m_cell: nullptr;}
 	inline PathfindCell *getPrevOpen() {return m_info->m_prevOpen?m_info->m_prevOpen->m_cell: nullptr;}
+	inline Int getOpenHeapIndex() const {return m_info->m_openHeapIndex;}
 
 	inline UnsignedShort getXIndex() const {return m_info->m_pos.x;}
 	inline UnsignedShort getYIndex() const {return m_info->m_pos.y;}
@@ -376,8 +397,6 @@ public:
 	inline UnsignedInt getCostSoFar() const {return m_info->m_costSoFar;}
 	inline UnsignedInt getTotalCost() const {return m_info->m_totalCost;}
 
-	inline UnsignedInt getTotalCostDifference(PathfindCell& other) const;
-
 	inline void setCostSoFar(UnsignedInt cost) { if( m_info ) m_info->m_costSoFar = cost;}
 	inline void setTotalCost(UnsignedInt cost) { if( m_info ) m_info->m_totalCost = cost;}
 
@@ -578,6 +597,12 @@ public:
 
 	void setAllPassable();
 
+	void getPassableBlocks(std::vector<Int> &blocks) const;	///< Collect the indices of all blocks marked passable.
+	void setPassableBlocks(const std::vector<Int> &blocks);	///< Mark exactly the given blocks passable.
+
+	/// Changes whenever the zones are recalculated, fully or partially.
+	UnsignedInt getZonesVersion() const { return m_zonesVersion; }
+
 	void setBridge(Int cellX, Int cellY, Bool bridge);
 	Bool interactsWithBridge(Int cellX, Int cellY) const;
 
@@ -593,6 +618,7 @@ private:
 
 	UnsignedShort m_maxZone;								///< Max zone used.
 	UnsignedInt		m_nextFrameToCalculateZones;		///< When should I recalculate, next?.
+	UnsignedInt		m_zonesVersion;								///< Incremented whenever the zones change.
 	UnsignedShort m_zonesAllocated;
 	zoneStorageType *m_groundCliffZones;
 	zoneStorageType *m_groundWaterZones;
@@ -679,6 +705,9 @@ public:
 
 	Bool queueForPath(ObjectID id);	 ///< The object wants to request a pathfind, so put it on the list to process.
 	void processPathfindQueue(); ///< Process some or all of the queued pathfinds.
+	Int getPathfindQueueLength() const { return (m_queuePRTail - m_queuePRHead + PATHFIND_QUEUE_LEN) % PATHFIND_QUEUE_LEN; } ///< Number of objects waiting in the pathfind queue
+	void getHierarchicalPathCacheStats(UnsignedInt *hits, UnsignedInt *misses, UnsignedInt *cellsSaved) const; ///< Statistics of the hierarchical path cache used by findPath
+	void getPathfindQueueStats(UnsignedInt *paths, UnsignedInt *cells, Real *timeMsec) const; ///< Paths, cells and time spent in processPathfindQueue since the last reset
 	void forceMapRecalculation();	///< Force pathfind map recomputation. If region is given, only that area is recomputed
 
 	/** Returns an aircraft path to the goal.  */
@@ -866,6 +895,34 @@ protected:
 	Path *buildGroundPath( Bool isCrusher,const Coord3D *fromPos, PathfindCell *goalCell,
 		Bool center, Int pathDiameter );	///< Work backwards from goal cell to construct final path
 	Path *buildHierarchicalPath( const Coord3D *fromPos, PathfindCell *goalCell);	///< Work backwards from goal cell to construct final path
+	void setPassableAroundStart( const Coord3D *startPos );	///< Mark the blocks around the start of a hierarchical path passable
+
+#if !RETAIL_COMPATIBLE_CRC
+	struct HierarchicalPathCacheKey
+	{
+		Int startBlockX, startBlockY;
+		Int goalBlockX, goalBlockY;
+		zoneStorageType startZone;
+		zoneStorageType goalZone;
+		LocomotorSurfaceTypeMask surfaces;
+		Bool crusher;
+		Bool isHuman;
+
+		bool operator<(const HierarchicalPathCacheKey &other) const;
+	};
+	struct HierarchicalPathCacheEntry
+	{
+		Bool found;
+		Int cellsExamined;
+		std::vector<Int> passableBlocks;
+	};
+	typedef std::map<HierarchicalPathCacheKey, HierarchicalPathCacheEntry> HierarchicalPathCache;
+
+	Bool makeHierarchicalPathCacheKey( Bool isHuman, const LocomotorSet& locomotorSet, const Coord3D *from,
+		const Coord3D *to, HierarchicalPathCacheKey &key );
+	Bool applyCachedHierarchicalPath( const HierarchicalPathCacheKey &key, const Coord3D *from );
+	void addHierarchicalPathCacheEntry( const HierarchicalPathCacheKey &key, Bool found, Int cellsExamined );
+#endif
 
 	void  prependCells( Path *path, const Coord3D *fromPos,
 																	PathfindCell *goalCell, Bool center ); ///< Add pathfind cells to a path.
@@ -917,6 +974,25 @@ private:
 	Int						m_queuePRHead;
 	Int						m_queuePRTail;
 	Int						m_cumulativeCellsAllocated;
+	std::vector<Bool>	m_isQueuedForPath;						///< Indexed by ObjectID, true while the object is in the pathfind queue
+
+	// Ronin @performance 16/10/2026
+	// Units of a group that move together request hierarchical paths between the same zone blocks. findPath
+	// keeps the blocks that the coarse route marked passable, so that later requests only refine the path.
+	// The cache is dropped whenever the zones or the logical extent change. Reusing a route from a nearby
+	// start cell can produce a different path, so the cache is not used for retail compatible CRCs.
+#if !RETAIL_COMPATIBLE_CRC
+	HierarchicalPathCache	m_hierarchicalPathCache;
+	UnsignedInt		m_hierarchicalPathCacheZonesVersion;
+	IRegion2D			m_hierarchicalPathCacheExtent;
+#endif
+	UnsignedInt		m_hierarchicalPathCacheHits;
+	UnsignedInt		m_hierarchicalPathCacheMisses;
+	UnsignedInt		m_hierarchicalPathCacheCellsSaved;		///< Cells the cached hierarchical searches examined originally
+
+	UnsignedInt		m_queueStatsPaths;										///< Paths processed by processPathfindQueue
+	UnsignedInt		m_queueStatsCells;										///< Cells examined by processPathfindQueue
+	Int64					m_queueStatsTime;											///< Performance counter ticks spent in processPathfindQueue
 
 #if RTS_ZEROHOUR && RETAIL_COMPATIBLE_CRC
 public:
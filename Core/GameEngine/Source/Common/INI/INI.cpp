@@ -323,34 +323,100 @@ void INI::unPrepFile()
 }
 
 //-------------------------------------------------------------------------------------------------
+struct BlockParseLess
+{
+	bool operator()(const BlockParse& block, const char* token) const
+	{
+		return strcmp(block.token, token) < 0;
+	}
+};
+
+//-------------------------------------------------------------------------------------------------
+// Ronin @performance 16/10/2026 The type table is sorted by token, so blocks are found with a binary search.
 static INIBlockParse findBlockParse(const char* token)
 {
-	for (size_t i = 0; i < ARRAY_SIZE(theTypeTable); ++i)
+#ifdef RTS_DEBUG
+	static Bool s_checkedSorted = FALSE;
+	if (!s_checkedSorted)
 	{
-		if (strcmp(theTypeTable[i].token, token) == 0)
+		for (size_t i = 1; i < ARRAY_SIZE(theTypeTable); ++i)
 		{
-			return theTypeTable[i].parse;
+			DEBUG_ASSERTCRASH(strcmp(theTypeTable[i - 1].token, theTypeTable[i].token) < 0,
+				("theTypeTable must be sorted by token, '%s' is misplaced", theTypeTable[i].token));
 		}
+		s_checkedSorted = TRUE;
+	}
+#endif
+
+	const BlockParse* end = theTypeTable + ARRAY_SIZE(theTypeTable);
+	const BlockParse* block = std::lower_bound(theTypeTable, end, token, BlockParseLess());
+	if (block != end && strcmp(block->token, token) == 0)
+	{
+		return block->parse;
 	}
 
 	return nullptr;
 }
 
 //-------------------------------------------------------------------------------------------------
-static INIFieldParseProc findFieldParse(const FieldParse* parseTable, const char* token, int& offset, const void*& userData)
+// Ronin @performance 16/10/2026 Maps the tokens of a field parse table to their first entry in that table.
+// Each table is indexed once on its first use, instead of comparing every field of every INI block
+// against all entries of the table. The parse tables are static data, so their addresses and tokens
+// stay valid for the lifetime of the index.
+class FieldParseIndex
 {
-	const FieldParse* parse = parseTable;
-	for (; parse->token; ++parse)
+public:
+	const FieldParse* find(const FieldParse* parseTable, const char* token)
+	{
+		const TokenMap& tokens = getTokenMap(parseTable);
+		TokenMap::const_iterator it = tokens.find(token);
+		if (it != tokens.end())
+			return it->second;
+
+		return nullptr;
+	}
+
+private:
+	typedef std::hash_map<const char*, const FieldParse*, rts::hash<const char*>, rts::equal_to<const char*> > TokenMap;
+	typedef std::map<const FieldParse*, TokenMap> TableMap;
+
+	const TokenMap& getTokenMap(const FieldParse* parseTable)
 	{
-		if (strcmp( parse->token, token ) == 0)
+		TableMap::iterator it = m_tables.find(parseTable);
+		if (it != m_tables.end())
+			return it->second;
+
+		TokenMap& tokens = m_tables[parseTable];
+		for (const FieldParse* parse = parseTable; parse->token; ++parse)
 		{
-			offset = parse->offset;
-			userData = parse->userData;
-			return parse->parse;
+			// insert does not replace, so the first entry of a duplicated token wins like it did with the linear search
+			tokens.insert(TokenMap::value_type(parse->token, parse));
 		}
+		return tokens;
 	}
 
-	if (!parse->token && parse->parse)
+	TableMap m_tables;
+};
+
+static FieldParseIndex theFieldParseIndex;
+
+//-------------------------------------------------------------------------------------------------
+static INIFieldParseProc findFieldParse(const FieldParse* parseTable, const char* token, int& offset, const void*& userData)
+{
+	const FieldParse* parse = theFieldParseIndex.find(parseTable, token);
+	if (parse)
+	{
+		offset = parse->offset;
+		userData = parse->userData;
+		return parse->parse;
+	}
+
+	// the table terminator may provide a parse function for all unknown tokens
+	parse = parseTable;
+	while (parse->token)
+		++parse;
+
+	if (parse->parse)
 	{
 		offset = parse->offset;
 		userData = token;
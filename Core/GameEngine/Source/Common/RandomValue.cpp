@@ -76,6 +76,19 @@ UnsignedInt GetGameLogicRandomSeedCRC()
 	return c.get();
 }
 
+void GetGameLogicRandomState( GameLogicRandomState *state )
+{
+	static_assert(sizeof(state->seed) == sizeof(theGameLogicSeed), "Incorrect array size");
+	memcpy(state->seed, theGameLogicSeed, sizeof(theGameLogicSeed));
+	state->baseSeed = theGameLogicBaseSeed;
+}
+
+void SetGameLogicRandomState( const GameLogicRandomState *state )
+{
+	memcpy(theGameLogicSeed, state->seed, sizeof(theGameLogicSeed));
+	theGameLogicBaseSeed = state->baseSeed;
+}
+
 static void seedRandom(UnsignedInt SEED, UnsignedInt (&seed)[6])
 {
 	UnsignedInt ax;
@@ -23,6 +23,8 @@
 #include "Common/GameEngine.h"
 #include "Common/LocalFileSystem.h"
 #include "Common/Recorder.h"
+#include "Common/ReplaySimulationReport.h"
+#include "Common/ReplaySnapshotCache.h"
 #include "Common/WorkerProcess.h"
 #include "GameLogic/GameLogic.h"
 #include "GameClient/GameClient.h"
@@ -45,6 +47,100 @@ int countProcessesRunning(const std::vector<WorkerProcess>& processes)
 	}
 	return numProcessesRunning;
 }
+
+// Ronin @performance 16/10/2026 A worker process that simulates more than one replay terminates the
+// output of each replay with one of these lines, so that the results can be attributed per replay.
+const char *const ReplayResultSuccess = "Replay Result: Success";
+const char *const ReplayResultError = "Replay Result: Error";
+
+// CreateProcessW accepts command lines of up to 32767 characters including the terminating null.
+const Int MaxWorkerCommandLength = 32767 - 1;
+
+Bool isReplayResultLine(const char *line, Bool &isError)
+{
+	if (strncmp(line, ReplayResultSuccess, strlen(ReplayResultSuccess)) == 0)
+	{
+		isError = FALSE;
+		return TRUE;
+	}
+	if (strncmp(line, ReplayResultError, strlen(ReplayResultError)) == 0)
+	{
+		isError = TRUE;
+		return TRUE;
+	}
+	return FALSE;
+}
+
+int printWorkerProcessOutput(const AsciiString &stdOutput, DWORD exitcode, int replayCount, int &filenamePositionDone, int filenameCount, ReplaySimulationReport *report)
+{
+	int numErrors = 0;
+
+	// Split the output of the worker into one section per replay. Each section ends with a result line
+	// if the worker simulated more than one replay. Report lines are collected and not printed.
+	int replaysDone = 0;
+	AsciiString section;
+	const char *lineStart = stdOutput.str();
+	while (*lineStart != '\0')
+	{
+		const char *lineEnd = strchr(lineStart, '\n');
+		const char *next = lineEnd != nullptr ? lineEnd + 1 : lineStart + strlen(lineStart);
+
+		ReplaySimulationReport::Entry entry;
+		Bool isError = FALSE;
+		if (report != nullptr && ReplaySimulationReport::parseEntryLine(lineStart, entry))
+		{
+			report->addEntry(entry);
+		}
+		else if (replayCount > 1 && replaysDone < replayCount && isReplayResultLine(lineStart, isError))
+		{
+			printf("%d/%d %s", filenamePositionDone+1, filenameCount, section.str());
+			if (isError)
+				printf("Error!\n");
+			numErrors += isError ? 1 : 0;
+			filenamePositionDone++;
+			replaysDone++;
+			section.clear();
+		}
+		else
+		{
+			AsciiString line;
+			line.set(lineStart, (Int)(next - lineStart));
+			section.concat(line);
+		}
+		lineStart = next;
+	}
+
+	if (replayCount == 1)
+	{
+		printf("%d/%d %s", filenamePositionDone+1, filenameCount, section.str());
+		if (exitcode != 0)
+			printf("Error!\n");
+		fflush(stdout);
+		numErrors += exitcode == 0 ? 0 : 1;
+		filenamePositionDone++;
+		return numErrors;
+	}
+
+	// The worker exited before it reported all of its replays. Attribute the remaining output to the
+	// first unreported replay and count all unreported replays as failed.
+	for (; replaysDone < replayCount; ++replaysDone)
+	{
+		printf("%d/%d %s", filenamePositionDone+1, filenameCount, section.str());
+		printf("Error!\n");
+		numErrors++;
+		filenamePositionDone++;
+		section.clear();
+	}
+	if (numErrors == 0 && exitcode != 0)
+	{
+		printf("%s", section.str());
+		printf("Error!\n");
+		numErrors++;
+	}
+	fflush(stdout);
+
+	return numErrors;
+}
 } // namespace
 
 int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString> &filenames)
@@ -74,19 +170,33 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 		return numErrors != 0 ? 1 : 0;
 	}
 	// Note that we use printf here because this is run from cmd.
+	// When we run as a worker process for more than one replay, the parent process expects a result line per replay.
+	const Bool printReplayResults = TheGlobalData->m_simulateReplayWorker && filenames.size() > 1;
+	const AsciiString &reportFilename = TheGlobalData->m_simulateReplayReport;
+	const Bool writeReport = reportFilename.isNotEmpty();
+	ReplaySimulationReport report;
+	ReplaySimulationReport::Collector reportCollector;
 	DWORD totalStartTimeMillis = GetTickCount();
 	for (size_t i = 0; i < filenames.size(); i++)
 	{
 		AsciiString filename = filenames[i];
 		printf("Simulating Replay \"%s\"\n", filename.str());
 		fflush(stdout);
+		const int numErrorsBefore = numErrors;
 		DWORD startTimeMillis = GetTickCount();
+		ReplaySimulationReport::ReplayResult reportResult = ReplaySimulationReport::REPLAY_RESULT_ERROR;
+		if (writeReport)
+			reportCollector.begin(filename);
 		if (TheRecorder->simulateReplay(filename))
 		{
 			UnsignedInt totalTimeSec = TheRecorder->getPlaybackFrameCount() / LOGICFRAMES_PER_SECOND;
 			while (TheRecorder->isPlaybackInProgress())
 			{
+				if (writeReport)
+					reportCollector.beginClientUpdate();
 				TheGameClient->updateHeadless();
+				if (writeReport)
+					reportCollector.endClientUpdate();
 
 				const int progressFrameInterval = 10*60*LOGICFRAMES_PER_SECOND;
 				if (TheGameLogic->getFrame() != 0 && TheGameLogic->getFrame() % progressFrameInterval == 0)
@@ -98,13 +208,18 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 							realTimeSec/60, realTimeSec%60, gameTimeSec/60, gameTimeSec%60, totalTimeSec/60, totalTimeSec%60);
 					fflush(stdout);
 				}
+				if (writeReport)
+					reportCollector.beginFrame();
 				TheGameLogic->UPDATE();
+				if (writeReport)
+					reportCollector.endFrame();
 				if (TheRecorder->sawCRCMismatch())
 				{
 					numErrors++;
 					break;
 				}
 			}
+			reportResult = TheRecorder->sawCRCMismatch() ? ReplaySimulationReport::REPLAY_RESULT_MISMATCH : ReplaySimulationReport::REPLAY_RESULT_SUCCESS;
 			UnsignedInt gameTimeSec = TheGameLogic->getFrame() / LOGICFRAMES_PER_SECOND;
 			UnsignedInt realTimeSec = (GetTickCount()-startTimeMillis) / 1000;
 			printf("Elapsed Time: %02d:%02d Game Time: %02d:%02d/%02d:%02d\n",
@@ -116,8 +231,22 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 			printf("Cannot open replay\n");
 			numErrors++;
 		}
+		if (writeReport)
+		{
+			ReplaySimulationReport::Entry entry;
+			reportCollector.finish(reportResult, TheRecorder->getCRCMismatchFrame(), entry);
+			if (ReplaySimulationReport::isStdOutput(reportFilename))
+				ReplaySimulationReport::printEntryLine(entry);
+			else
+				report.addEntry(entry);
+		}
+		if (printReplayResults)
+		{
+			printf("%s\n", numErrors == numErrorsBefore ? ReplayResultSuccess : ReplayResultError);
+			fflush(stdout);
+		}
 	}
-	if (filenames.size() > 1)
+	if (filenames.size() > 1 && !printReplayResults)
 	{
 		printf("Simulation of all replays completed. Errors occurred: %d\n", numErrors);
 
@@ -125,11 +254,116 @@ int ReplaySimulation::simulateReplaysInThisProcess(const std::vector<AsciiString
 		printf("Total Time: %d:%02d:%02d\n", realTime/60/60, realTime/60%60, realTime%60);
 		fflush(stdout);
 	}
+	if (writeReport && !ReplaySimulationReport::isStdOutput(reportFilename))
+	{
+		if (!report.writeFile(reportFilename))
+			numErrors++;
+	}
 
 	return numErrors != 0 ? 1 : 0;
 }
 
-int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiString> &filenames, int maxProcesses)
+int ReplaySimulation::simulateReplaySeekBenchmark(const std::vector<AsciiString> &filenames)
+{
+	const UnsignedInt seekFrame = (UnsignedInt)TheGlobalData->m_simulateReplaySeekFrame;
+	UnsignedInt snapshotInterval = TheGlobalData->m_replaySnapshotInterval;
+	if (snapshotInterval == 0)
+		snapshotInterval = 60*LOGICFRAMES_PER_SECOND;
+
+	int numErrors = 0;
+	ReplaySnapshotCache snapshotCache;
+	snapshotCache.setInterval(snapshotInterval);
+
+	for (size_t i = 0; i < filenames.size(); i++)
+	{
+		AsciiString filename = filenames[i];
+		printf("Benchmarking seek to frame %u in Replay \"%s\"\n", seekFrame, filename.str());
+		fflush(stdout);
+
+		snapshotCache.clear();
+		if (!TheRecorder->simulateReplay(filename))
+		{
+			printf("Cannot open replay\n");
+			numErrors++;
+			continue;
+		}
+
+		// Simulate the whole replay once to fill the snapshot cache. The time it takes to reach the
+		// seek frame this way is the seek latency without the cache.
+		DWORD startTimeMillis = GetTickCount();
+		DWORD snapshotTimeMillis = 0;
+		DWORD frameReachedMillis = 0;
+		Bool frameReached = FALSE;
+		while (TheRecorder->isPlaybackInProgress())
+		{
+			TheGameClient->updateHeadless();
+			TheGameLogic->UPDATE();
+			if (!frameReached && TheGameLogic->isInGame() && TheGameLogic->getFrame() >= seekFrame)
+			{
+				frameReached = TRUE;
+				frameReachedMillis = GetTickCount() - startTimeMillis - snapshotTimeMillis;
+			}
+			DWORD snapshotStartMillis = GetTickCount();
+			snapshotCache.update();
+			snapshotTimeMillis += GetTickCount() - snapshotStartMillis;
+			if (TheRecorder->sawCRCMismatch())
+				break;
+		}
+
+		if (TheRecorder->sawCRCMismatch() || !frameReached)
+		{
+			printf(frameReached ? "CRC Mismatch before the seek benchmark\n" : "Replay ends before the seek frame\n");
+			numErrors++;
+			continue;
+		}
+
+		printf("Simulation from start to frame %u: %u ms\n", seekFrame, frameReachedMillis);
+		printf("Snapshots taken: %u every %u frames, %u KB, %u ms\n", snapshotCache.getSnapshotCount(), snapshotInterval,
+			(UnsignedInt)(snapshotCache.getMemoryUsage() / 1024), snapshotTimeMillis);
+
+		DWORD seekStartMillis = GetTickCount();
+		const Bool seekSuccess = snapshotCache.seek(seekFrame);
+		DWORD seekMillis = GetTickCount() - seekStartMillis;
+		if (seekSuccess)
+		{
+			printf("Seek to frame %u from snapshot at frame %d: %u ms\n", seekFrame, snapshotCache.getLastRestoredFrame(), seekMillis);
+
+			// Play on until the next recorded CRC is compared, which verifies that the restored state is in sync.
+			const UnsignedInt crcChecksBefore = TheRecorder->getCRCCheckCount();
+			while (TheRecorder->isPlaybackInProgress() && !TheRecorder->sawCRCMismatch()
+				&& TheRecorder->getCRCCheckCount() == crcChecksBefore)
+			{
+				TheGameClient->updateHeadless();
+				TheGameLogic->UPDATE();
+			}
+
+			if (TheRecorder->sawCRCMismatch())
+			{
+				printf("CRC Mismatch after the seek\n");
+				numErrors++;
+			}
+			else if (TheRecorder->getCRCCheckCount() == crcChecksBefore)
+			{
+				printf("No CRC recorded after frame %u, the seek is not verified\n", seekFrame);
+			}
+			else
+			{
+				printf("CRC after the seek matches in frame %u\n", TheGameLogic->getFrame());
+			}
+		}
+		else
+		{
+			printf("Seek to frame %u failed\n", seekFrame);
+			numErrors++;
+		}
+		fflush(stdout);
+	}
+
+	snapshotCache.clear();
+	return numErrors != 0 ? 1 : 0;
+}
+
+int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiString> &filenames, int maxProcesses, int replaysPerProcess)
 {
 	DWORD totalStartTimeMillis = GetTickCount();
 
@@ -137,6 +371,10 @@ int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiSt
 	GetModuleFileNameW(nullptr, exePath, ARRAY_SIZE(exePath));
 
 	std::vector<WorkerProcess> processes;
+	std::vector<int> processReplayCounts;
+	const AsciiString &reportFilename = TheGlobalData->m_simulateReplayReport;
+	const Bool writeReport = reportFilename.isNotEmpty();
+	ReplaySimulationReport report;
 	int filenamePositionStarted = 0;
 	int filenamePositionDone = 0;
 	int numErrors = 0;
@@ -152,15 +390,18 @@ int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiSt
 		{
 			if (!processes[0].isDone())
 				break;
-			AsciiString stdOutput = processes[0].getStdOutput();
-			printf("%d/%d %s", filenamePositionDone+1, (int)filenames.size(), stdOutput.str());
-			DWORD exitcode = processes[0].getExitCode();
-			if (exitcode != 0)
-				printf("Error!\n");
-			fflush(stdout);
-			numErrors += exitcode == 0 ? 0 : 1;
+			numErrors += printWorkerProcessOutput(processes[0].getStdOutput(), processes[0].getExitCode(),
+				processReplayCounts[0], filenamePositionDone, (int)filenames.size(), writeReport ? &report : nullptr);
+
+			// Replays the worker did not report on, for example because it crashed, are reported as errors.
+			while (writeReport && report.getEntryCount() < filenamePositionDone)
+			{
+				ReplaySimulationReport::Entry entry;
+				entry.filename = filenames[report.getEntryCount()];
+				report.addEntry(entry);
+			}
 			processes.erase(processes.begin());
-			filenamePositionDone++;
+			processReplayCounts.erase(processReplayCounts.begin());
 		}
 
 		int numProcessesRunning = countProcessesRunning(processes);
@@ -168,19 +409,42 @@ int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiSt
 		// Add new processes when we are below the limit and there are replays left
 		while (numProcessesRunning < maxProcesses && filenamePositionStarted < filenames.size())
 		{
-			UnicodeString filenameWide;
-			filenameWide.translate(filenames[filenamePositionStarted]);
+			// Ronin @performance 16/10/2026 Hand each worker a batch of consecutive replays so that it loads
+			// the game data once for all of them. Keep the batches small enough to still use all processes.
+			const int filenamesLeft = (int)filenames.size() - filenamePositionStarted;
+			int replayCount = (filenamesLeft + maxProcesses - 1) / maxProcesses;
+			replayCount = std::min(replayCount, replaysPerProcess);
+			replayCount = std::max(replayCount, 1);
+
 			UnicodeString command;
-			command.format(L"\"%s\"%s%s -replay \"%s\"",
+			command.format(L"\"%s\" -replayWorker%s%s",
 				exePath,
 				TheGlobalData->m_windowed ? L" -win" : L"",
-				TheGlobalData->m_headless ? L" -headless" : L"",
-				filenameWide.str());
+				TheGlobalData->m_headless ? L" -headless" : L"");
+			if (writeReport)
+				command.concat(L" -replayReport -");
+			for (int j = 0; j < replayCount; ++j)
+			{
+				UnicodeString filenameWide;
+				filenameWide.translate(filenames[filenamePositionStarted + j]);
+				UnicodeString replayArg;
+				replayArg.format(L" -replay \"%s\"", filenameWide.str());
+
+				// End the batch early rather than exceed the command line limit. The first replay is always
+				// added, a single filename that is too long fails in the worker like it would without batches.
+				if (j > 0 && command.getLength() + replayArg.getLength() > MaxWorkerCommandLength)
+				{
+					replayCount = j;
+					break;
+				}
+				command.concat(replayArg);
+			}
 
 			processes.push_back(WorkerProcess());
+			processReplayCounts.push_back(replayCount);
 			processes.back().startProcess(command);
 
-			filenamePositionStarted++;
+			filenamePositionStarted += replayCount;
 			numProcessesRunning++;
 		}
 
@@ -200,6 +464,19 @@ int ReplaySimulation::simulateReplaysInWorkerProcesses(const std::vector<AsciiSt
 	printf("Total Wall Time: %d:%02d:%02d\n", realTime/60/60, realTime/60%60, realTime%60);
 	fflush(stdout);
 
+	if (writeReport)
+	{
+		if (ReplaySimulationReport::isStdOutput(reportFilename))
+		{
+			for (Int i = 0; i < report.getEntryCount(); ++i)
+				ReplaySimulationReport::printEntryLine(report.getEntry(i));
+		}
+		else if (!report.writeFile(reportFilename))
+		{
+			numErrors++;
+		}
+	}
+
 	return numErrors != 0 ? 1 : 0;
 }
 
@@ -248,8 +525,10 @@ std::vector<AsciiString> ReplaySimulation::resolveFilenameWildcards(const std::v
 int ReplaySimulation::simulateReplays(const std::vector<AsciiString> &filenames, int maxProcesses)
 {
 	std::vector<AsciiString> filenamesResolved = resolveFilenameWildcards(filenames);
+	if (TheGlobalData->m_simulateReplaySeekFrame >= 0 && TheGlobalData->m_headless)
+		return simulateReplaySeekBenchmark(filenamesResolved);
 	if (maxProcesses == SIMULATE_REPLAYS_SEQUENTIAL)
 		return simulateReplaysInThisProcess(filenamesResolved);
 	else
-		return simulateReplaysInWorkerProcesses(filenamesResolved, maxProcesses);
+		return simulateReplaysInWorkerProcesses(filenamesResolved, maxProcesses, TheGlobalData->m_simulateReplaysPerJob);
 }
@@ -0,0 +1,350 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/ReplaySimulationReport.h"
+
+#include "GameLogic/AI.h"
+#include "GameLogic/AIPathfind.h"
+#include "GameLogic/GameLogic.h"
+#include "GameLogic/Weapon.h"
+
+
+namespace
+{
+const char *const EntryLinePrefix = "Replay Report: ";
+
+const char *const ReplayResultNames[] =
+{
+	"success",
+	"mismatch",
+	"error",
+};
+static_assert(ARRAY_SIZE(ReplayResultNames) == ReplaySimulationReport::REPLAY_RESULT_COUNT, "Incorrect array size");
+
+Int64 getPerformanceCounter()
+{
+	LARGE_INTEGER counter;
+	QueryPerformanceCounter(&counter);
+	return counter.QuadPart;
+}
+
+// Nearest rank percentile of an already sorted list.
+Real getPercentile(const std::vector<Real> &sortedValues, Real percentile)
+{
+	if (sortedValues.empty())
+		return 0.0f;
+	size_t rank = (size_t)ceilf(percentile * sortedValues.size());
+	if (rank < 1)
+		rank = 1;
+	if (rank > sortedValues.size())
+		rank = sortedValues.size();
+	return sortedValues[rank - 1];
+}
+
+// Escapes backslashes and quotes, which are the only special characters expected in replay filenames.
+AsciiString escapeJsonString(const AsciiString &str)
+{
+	AsciiString escaped;
+	for (const char *c = str.str(); *c != '\0'; ++c)
+	{
+		if (*c == '\\' || *c == '"')
+			escaped.concat('\\');
+		escaped.concat(*c);
+	}
+	return escaped;
+}
+} // namespace
+
+ReplaySimulationReport::Entry::Entry()
+	: result(REPLAY_RESULT_ERROR)
+	, mismatchFrame(-1)
+	, frameCount(0)
+	, wallTimeMsec(0)
+	, logicFramesPerSecond(0.0f)
+	, frameTimeP50Msec(0.0f)
+	, frameTimeP99Msec(0.0f)
+	, frameTimeMaxMsec(0.0f)
+	, peakObjectCount(0)
+	, peakPathfindQueueLength(0)
+	, peakWaitingForPath(-1)
+	, failedPathfinds(-1)
+	, pathfindPaths(0)
+	, pathfindCells(0)
+	, pathfindTimeMsec(0.0f)
+	, pathCacheHits(0)
+	, pathCacheMisses(0)
+	, pathCacheCellsSaved(0)
+	, clientTimeMsec(0.0f)
+	, logicTimeMsec(0.0f)
+	, overlapTimeMsec(0.0f)
+	, areaDamageDetonations(0)
+	, areaDamageVictims(0)
+	, areaDamageTimeMsec(0.0f)
+{
+}
+
+ReplaySimulationReport::Collector::Collector()
+	: m_freq(1)
+	, m_startTime(0)
+	, m_frameStartTime(0)
+	, m_clientStartTime(0)
+	, m_clientTimeMsec(0.0f)
+	, m_totalClientTimeMsec(0.0f)
+	, m_totalOverlapTimeMsec(0.0f)
+	, m_peakObjectCount(0)
+	, m_peakPathfindQueueLength(0)
+	, m_peakWaitingForPath(-1)
+{
+	LARGE_INTEGER freq;
+	QueryPerformanceFrequency(&freq);
+	m_freq = freq.QuadPart;
+}
+
+void ReplaySimulationReport::Collector::begin(const AsciiString &filename)
+{
+	m_filename = filename;
+	m_frameTimesMsec.clear();
+	m_startTime = getPerformanceCounter();
+	m_frameStartTime = m_startTime;
+	m_clientStartTime = m_startTime;
+	m_clientTimeMsec = 0.0f;
+	m_totalClientTimeMsec = 0.0f;
+	m_totalOverlapTimeMsec = 0.0f;
+	m_peakObjectCount = 0;
+	m_peakPathfindQueueLength = 0;
+	m_peakWaitingForPath = -1;
+
+	if (TheWeaponStore != nullptr)
+		TheWeaponStore->setAreaDamageStatsEnabled(TRUE);
+}
+
+void ReplaySimulationReport::Collector::beginClientUpdate()
+{
+	m_clientStartTime = getPerformanceCounter();
+}
+
+void ReplaySimulationReport::Collector::endClientUpdate()
+{
+	m_clientTimeMsec += getElapsedMsec(m_clientStartTime, getPerformanceCounter());
+}
+
+void ReplaySimulationReport::Collector::beginFrame()
+{
+	m_frameStartTime = getPerformanceCounter();
+}
+
+void ReplaySimulationReport::Collector::endFrame()
+{
+	const Real frameTimeMsec = getElapsedMsec(m_frameStartTime, getPerformanceCounter());
+	m_frameTimesMsec.push_back(frameTimeMsec);
+
+	// With logic and client pipelined, the client of this frame would run while the logic computes the next one.
+	m_totalClientTimeMsec += m_clientTimeMsec;
+	m_totalOverlapTimeMsec += std::min(m_clientTimeMsec, frameTimeMsec);
+	m_clientTimeMsec = 0.0f;
+
+	// Sample the logic state after the frame time was taken so it does not distort the frame times.
+	m_peakObjectCount = std::max(m_peakObjectCount, TheGameLogic->getObjectCount());
+	if (TheAI != nullptr && TheAI->pathfinder() != nullptr)
+	{
+		const UnsignedInt queueLength = (UnsignedInt)TheAI->pathfinder()->getPathfindQueueLength();
+		m_peakPathfindQueueLength = std::max(m_peakPathfindQueueLength, queueLength);
+	}
+
+#ifdef DUMP_PERF_STATS
+	UnsignedInt numAI, numMoving, numAttacking, numWaitingForPath, overallFailedPathfinds;
+	TheGameLogic->getAIMetricsStatistics(&numAI, &numMoving, &numAttacking, &numWaitingForPath, &overallFailedPathfinds);
+	m_peakWaitingForPath = std::max(m_peakWaitingForPath, (Int)numWaitingForPath);
+#endif
+}
+
+void ReplaySimulationReport::Collector::finish(ReplayResult result, Int mismatchFrame, Entry &entry)
+{
+	entry = Entry();
+	entry.filename = m_filename;
+	entry.result = result;
+	entry.mismatchFrame = mismatchFrame;
+	entry.frameCount = (UnsignedInt)m_frameTimesMsec.size();
+	entry.wallTimeMsec = (UnsignedInt)getElapsedMsec(m_startTime, getPerformanceCounter());
+	entry.peakObjectCount = m_peakObjectCount;
+	entry.peakPathfindQueueLength = m_peakPathfindQueueLength;
+	entry.peakWaitingForPath = m_peakWaitingForPath;
+	entry.clientTimeMsec = m_totalClientTimeMsec;
+	entry.overlapTimeMsec = m_totalOverlapTimeMsec;
+#ifdef DUMP_PERF_STATS
+	entry.failedPathfinds = (Int)TheGameLogic->getOverallFailedPathfinds();
+#endif
+	if (TheAI != nullptr && TheAI->pathfinder() != nullptr)
+	{
+		TheAI->pathfinder()->getPathfindQueueStats(&entry.pathfindPaths, &entry.pathfindCells, &entry.pathfindTimeMsec);
+		TheAI->pathfinder()->getHierarchicalPathCacheStats(&entry.pathCacheHits, &entry.pathCacheMisses, &entry.pathCacheCellsSaved);
+	}
+	if (TheWeaponStore != nullptr)
+		TheWeaponStore->getAreaDamageStats(&entry.areaDamageDetonations, &entry.areaDamageVictims, &entry.areaDamageTimeMsec);
+
+	if (!m_frameTimesMsec.empty())
+	{
+		std::vector<Real> sortedFrameTimes = m_frameTimesMsec;
+		std::sort(sortedFrameTimes.begin(), sortedFrameTimes.end());
+
+		Real totalFrameTimeMsec = 0.0f;
+		for (size_t i = 0; i < sortedFrameTimes.size(); ++i)
+			totalFrameTimeMsec += sortedFrameTimes[i];
+
+		entry.frameTimeP50Msec = getPercentile(sortedFrameTimes, 0.50f);
+		entry.frameTimeP99Msec = getPercentile(sortedFrameTimes, 0.99f);
+		entry.frameTimeMaxMsec = sortedFrameTimes.back();
+		entry.logicTimeMsec = totalFrameTimeMsec;
+		if (totalFrameTimeMsec > 0.0f)
+			entry.logicFramesPerSecond = sortedFrameTimes.size() * 1000.0f / totalFrameTimeMsec;
+	}
+}
+
+Real ReplaySimulationReport::Collector::getElapsedMsec(Int64 start, Int64 end) const
+{
+	return (Real)((double)(end - start) * 1000.0 / (double)m_freq);
+}
+
+Bool ReplaySimulationReport::isStdOutput(const AsciiString &reportFilename)
+{
+	return reportFilename.compare("-") == 0;
+}
+
+void ReplaySimulationReport::addEntry(const Entry &entry)
+{
+	m_entries.push_back(entry);
+}
+
+Bool ReplaySimulationReport::writeFile(const AsciiString &reportFilename) const
+{
+	FILE *fp = fopen(reportFilename.str(), "w");
+	if (fp == nullptr)
+	{
+		printf("Cannot write replay report \"%s\"\n", reportFilename.str());
+		return FALSE;
+	}
+
+	if (reportFilename.endsWithNoCase(".csv"))
+		writeCsv(fp);
+	else
+		writeJson(fp);
+
+	fclose(fp);
+	return TRUE;
+}
+
+void ReplaySimulationReport::writeJson(FILE *fp) const
+{
+	fprintf(fp, "{\n  \"replays\": [");
+	for (size_t i = 0; i < m_entries.size(); ++i)
+	{
+		const Entry &entry = m_entries[i];
+		fprintf(fp, "%s\n    {\n", i == 0 ? "" : ",");
+		fprintf(fp, "      \"filename\": \"%s\",\n", escapeJsonString(entry.filename).str());
+		fprintf(fp, "      \"result\": \"%s\",\n", ReplayResultNames[entry.result]);
+		fprintf(fp, "      \"mismatchFrame\": %d,\n", entry.mismatchFrame);
+		fprintf(fp, "      \"frameCount\": %u,\n", entry.frameCount);
+		fprintf(fp, "      \"wallTimeMsec\": %u,\n", entry.wallTimeMsec);
+		fprintf(fp, "      \"logicFramesPerSecond\": %.2f,\n", entry.logicFramesPerSecond);
+		fprintf(fp, "      \"frameTimeP50Msec\": %.3f,\n", entry.frameTimeP50Msec);
+		fprintf(fp, "      \"frameTimeP99Msec\": %.3f,\n", entry.frameTimeP99Msec);
+		fprintf(fp, "      \"frameTimeMaxMsec\": %.3f,\n", entry.frameTimeMaxMsec);
+		fprintf(fp, "      \"peakObjectCount\": %u,\n", entry.peakObjectCount);
+		fprintf(fp, "      \"peakPathfindQueueLength\": %u,\n", entry.peakPathfindQueueLength);
+		fprintf(fp, "      \"peakWaitingForPath\": %d,\n", entry.peakWaitingForPath);
+		fprintf(fp, "      \"failedPathfinds\": %d,\n", entry.failedPathfinds);
+		fprintf(fp, "      \"pathfindPaths\": %u,\n", entry.pathfindPaths);
+		fprintf(fp, "      \"pathfindCells\": %u,\n", entry.pathfindCells);
+		fprintf(fp, "      \"pathfindTimeMsec\": %.3f,\n", entry.pathfindTimeMsec);
+		fprintf(fp, "      \"pathCacheHits\": %u,\n", entry.pathCacheHits);
+		fprintf(fp, "      \"pathCacheMisses\": %u,\n", entry.pathCacheMisses);
+		fprintf(fp, "      \"pathCacheCellsSaved\": %u,\n", entry.pathCacheCellsSaved);
+		fprintf(fp, "      \"clientTimeMsec\": %.3f,\n", entry.clientTimeMsec);
+		fprintf(fp, "      \"logicTimeMsec\": %.3f,\n", entry.logicTimeMsec);
+		fprintf(fp, "      \"overlapTimeMsec\": %.3f,\n", entry.overlapTimeMsec);
+		fprintf(fp, "      \"areaDamageDetonations\": %u,\n", entry.areaDamageDetonations);
+		fprintf(fp, "      \"areaDamageVictims\": %u,\n", entry.areaDamageVictims);
+		fprintf(fp, "      \"areaDamageTimeMsec\": %.3f\n", entry.areaDamageTimeMsec);
+		fprintf(fp, "    }");
+	}
+	fprintf(fp, "\n  ]\n}\n");
+}
+
+void ReplaySimulationReport::writeCsv(FILE *fp) const
+{
+	fprintf(fp, "filename,result,mismatchFrame,frameCount,wallTimeMsec,logicFramesPerSecond,"
+		"frameTimeP50Msec,frameTimeP99Msec,frameTimeMaxMsec,peakObjectCount,peakPathfindQueueLength,"
+		"peakWaitingForPath,failedPathfinds,pathfindPaths,pathfindCells,pathfindTimeMsec,pathCacheHits,"
+		"pathCacheMisses,pathCacheCellsSaved,clientTimeMsec,logicTimeMsec,overlapTimeMsec,areaDamageDetonations,"
+		"areaDamageVictims,areaDamageTimeMsec\n");
+	for (size_t i = 0; i < m_entries.size(); ++i)
+	{
+		const Entry &entry = m_entries[i];
+		fprintf(fp, "\"%s\",%s,%d,%u,%u,%.2f,%.3f,%.3f,%.3f,%u,%u,%d,%d,%u,%u,%.3f,%u,%u,%u,%.3f,%.3f,%.3f,%u,%u,%.3f\n",
+			entry.filename.str(), ReplayResultNames[entry.result], entry.mismatchFrame, entry.frameCount,
+			entry.wallTimeMsec, entry.logicFramesPerSecond, entry.frameTimeP50Msec, entry.frameTimeP99Msec,
+			entry.frameTimeMaxMsec, entry.peakObjectCount, entry.peakPathfindQueueLength,
+			entry.peakWaitingForPath, entry.failedPathfinds, entry.pathfindPaths, entry.pathfindCells,
+			entry.pathfindTimeMsec, entry.pathCacheHits, entry.pathCacheMisses, entry.pathCacheCellsSaved,
+			entry.clientTimeMsec, entry.logicTimeMsec, entry.overlapTimeMsec, entry.areaDamageDetonations,
+			entry.areaDamageVictims, entry.areaDamageTimeMsec);
+	}
+}
+
+void ReplaySimulationReport::printEntryLine(const Entry &entry)
+{
+	// The filename goes last because it may contain spaces.
+	printf("%s%d %d %u %u %f %f %f %f %u %u %d %d %u %u %f %u %u %u %f %f %f %u %u %f %s\n", EntryLinePrefix,
+		(Int)entry.result, entry.mismatchFrame, entry.frameCount, entry.wallTimeMsec, entry.logicFramesPerSecond,
+		entry.frameTimeP50Msec, entry.frameTimeP99Msec, entry.frameTimeMaxMsec, entry.peakObjectCount,
+		entry.peakPathfindQueueLength, entry.peakWaitingForPath, entry.failedPathfinds, entry.pathfindPaths,
+		entry.pathfindCells, entry.pathfindTimeMsec, entry.pathCacheHits, entry.pathCacheMisses, entry.pathCacheCellsSaved,
+		entry.clientTimeMsec, entry.logicTimeMsec, entry.overlapTimeMsec, entry.areaDamageDetonations,
+		entry.areaDamageVictims, entry.areaDamageTimeMsec, entry.filename.str());
+	fflush(stdout);
+}
+
+Bool ReplaySimulationReport::parseEntryLine(const char *line, Entry &entry)
+{
+	const size_t prefixLength = strlen(EntryLinePrefix);
+	if (strncmp(line, EntryLinePrefix, prefixLength) != 0)
+		return FALSE;
+
+	Int result = 0;
+	Int filenameOffset = 0;
+	const Int numFields = sscanf(line + prefixLength, "%d %d %u %u %f %f %f %f %u %u %d %d %u %u %f %u %u %u %f %f %f %u %u %f %n",
+		&result, &entry.mismatchFrame, &entry.frameCount, &entry.wallTimeMsec, &entry.logicFramesPerSecond,
+		&entry.frameTimeP50Msec, &entry.frameTimeP99Msec, &entry.frameTimeMaxMsec, &entry.peakObjectCount,
+		&entry.peakPathfindQueueLength, &entry.peakWaitingForPath, &entry.failedPathfinds, &entry.pathfindPaths,
+		&entry.pathfindCells, &entry.pathfindTimeMsec, &entry.pathCacheHits, &entry.pathCacheMisses, &entry.pathCacheCellsSaved,
+		&entry.clientTimeMsec, &entry.logicTimeMsec, &entry.overlapTimeMsec, &entry.areaDamageDetonations,
+		&entry.areaDamageVictims, &entry.areaDamageTimeMsec, &filenameOffset);
+	if (numFields != 24 || result < 0 || result >= REPLAY_RESULT_COUNT)
+		return FALSE;
+	entry.result = (ReplayResult)result;
+
+	// Take the rest of the line as filename.
+	const char *filename = line + prefixLength + filenameOffset;
+	size_t filenameLength = strcspn(filename, "\r\n");
+	while (filenameLength > 0 && filename[filenameLength - 1] == ' ')
+		--filenameLength;
+	entry.filename.set(filename, (Int)filenameLength);
+	return TRUE;
+}
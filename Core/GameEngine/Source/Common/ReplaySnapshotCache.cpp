@@ -0,0 +1,160 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/ReplaySnapshotCache.h"
+
+#include "Common/GameEngine.h"
+#include "Common/GameState.h"
+#include "GameClient/GameClient.h"
+#include "GameLogic/GameLogic.h"
+
+
+ReplaySnapshotCache::ReplaySnapshotCache()
+	: m_interval(0)
+	, m_lastRestoredFrame(-1)
+{
+}
+
+ReplaySnapshotCache::~ReplaySnapshotCache()
+{
+	clear();
+}
+
+void ReplaySnapshotCache::clear()
+{
+	for (size_t i = 0; i < m_snapshots.size(); ++i)
+		delete m_snapshots[i];
+	m_snapshots.clear();
+	m_replayFilename.clear();
+	m_lastRestoredFrame = -1;
+}
+
+void ReplaySnapshotCache::update()
+{
+	if (m_interval == 0 || !TheRecorder->isPlaybackInProgress() || !TheGameLogic->isInGame())
+		return;
+
+	// A different replay invalidates all snapshots.
+	if (m_replayFilename.compare(TheRecorder->getCurrentReplayFilename()) != 0)
+	{
+		clear();
+		m_replayFilename = TheRecorder->getCurrentReplayFilename();
+	}
+
+	const UnsignedInt frame = TheGameLogic->getFrame();
+	if (frame == 0 || frame % m_interval != 0)
+		return;
+
+	// Frames that are simulated again after a restore already have their snapshot.
+	if (!m_snapshots.empty() && m_snapshots.back()->frame >= frame)
+		return;
+
+	takeSnapshot();
+}
+
+Bool ReplaySnapshotCache::takeSnapshot()
+{
+	ReplaySnapshot *snapshot = NEW ReplaySnapshot;
+	snapshot->frame = TheGameLogic->getFrame();
+
+	if (!TheRecorder->getPlaybackState(snapshot->playbackState)
+		|| TheGameState->saveGameToBuffer(snapshot->gameState) != SC_OK)
+	{
+		DEBUG_LOG(("ReplaySnapshotCache - Unable to take snapshot at frame %u", snapshot->frame));
+		delete snapshot;
+		return FALSE;
+	}
+	GetGameLogicRandomState(&snapshot->randomState);
+
+	m_snapshots.push_back(snapshot);
+	return TRUE;
+}
+
+Bool ReplaySnapshotCache::restoreSnapshot(const ReplaySnapshot &snapshot)
+{
+	// Same order as a regular save game load, except that the playback is restored before the game
+	// state, because starting the game from the save data reads the game info from the recorder.
+	TheGameEngine->reset();
+
+	if (!TheRecorder->restorePlaybackState(snapshot.playbackState))
+		return FALSE;
+
+	if (TheGameState->loadGameFromBuffer(snapshot.gameState) != SC_OK)
+		return FALSE;
+
+	// The random state is not part of the save data and loading the game consumes random values.
+	SetGameLogicRandomState(&snapshot.randomState);
+
+	DEBUG_ASSERTCRASH(TheGameLogic->getFrame() == snapshot.frame, ("ReplaySnapshotCache - Restored frame %u, expected %u",
+		TheGameLogic->getFrame(), snapshot.frame));
+	return TRUE;
+}
+
+const ReplaySnapshotCache::ReplaySnapshot *ReplaySnapshotCache::findSnapshot(UnsignedInt frame) const
+{
+	const ReplaySnapshot *best = nullptr;
+	for (size_t i = 0; i < m_snapshots.size(); ++i)
+	{
+		if (m_snapshots[i]->frame > frame)
+			break;
+		best = m_snapshots[i];
+	}
+	return best;
+}
+
+Bool ReplaySnapshotCache::seek(UnsignedInt frame)
+{
+	m_lastRestoredFrame = -1;
+
+	const ReplaySnapshot *snapshot = findSnapshot(frame);
+	const Bool canSimulateForward = TheRecorder->isPlaybackInProgress() && TheGameLogic->isInGame()
+		&& TheGameLogic->getFrame() <= frame;
+
+	// Restore a snapshot unless the current playback is already closer to the frame.
+	if (snapshot != nullptr && (!canSimulateForward || TheGameLogic->getFrame() < snapshot->frame))
+	{
+		if (!restoreSnapshot(*snapshot))
+			return FALSE;
+		m_lastRestoredFrame = (Int)snapshot->frame;
+	}
+	else if (!canSimulateForward)
+	{
+		// There is no snapshot early enough, so start over from the beginning.
+		if (m_replayFilename.isEmpty() || !TheRecorder->simulateReplay(m_replayFilename))
+			return FALSE;
+	}
+
+	while (TheRecorder->isPlaybackInProgress() && (!TheGameLogic->isInGame() || TheGameLogic->getFrame() < frame))
+	{
+		TheGameClient->updateHeadless();
+		TheGameLogic->UPDATE();
+		update();
+	}
+
+	return TheGameLogic->isInGame() && TheGameLogic->getFrame() == frame;
+}
+
+size_t ReplaySnapshotCache::getMemoryUsage() const
+{
+	size_t bytes = 0;
+	for (size_t i = 0; i < m_snapshots.size(); ++i)
+		bytes += m_snapshots[i]->gameState.size();
+	return bytes;
+}
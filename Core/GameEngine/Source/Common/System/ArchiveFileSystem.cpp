@@ -92,6 +92,52 @@ ArchiveFileSystem *TheArchiveFileSystem = nullptr;
 //         Private Functions
 //----------------------------------------------------------------------------
 
+enum { MAX_ARCHIVED_FILE_PATH_LEN = 1024 };
+
+//------------------------------------------------------
+/**
+	Write the index key of the given file name to the buffer. This must match the way
+	getArchivedDirectoryInfo() splits a path: the name is lowercased, and every token before
+	the token that holds the last '.' is a directory. Tokens after that one are ignored.
+	Returns false if the key does not fit in the buffer.
+*/
+static Bool makeArchivedFilePath(const Char *filename, Char *buffer, Int bufferSize)
+{
+	const Char *lastDot = strrchr(filename, '.');
+	const Char *end = buffer + bufferSize - 1;
+	Char *out = buffer;
+	const Char *c = filename;
+
+	for (;;)
+	{
+		while (*c == '\\' || *c == '/')
+			++c;
+
+		if (*c == '\0')
+			break;
+
+		const Char *tokenStart = c;
+		while (*c != '\0' && *c != '\\' && *c != '/')
+			++c;
+
+		const Int tokenLen = c - tokenStart;
+		const Bool isFile = lastDot != nullptr && lastDot >= tokenStart && lastDot < c;
+		if (out + tokenLen + (isFile ? 0 : 1) > end)
+			return false;
+
+		for (Int i = 0; i < tokenLen; ++i)
+			*out++ = tolower(tokenStart[i]);
+
+		if (isFile)
+			break;
+
+		*out++ = '\\';
+	}
+
+	*out = '\0';
+	return true;
+}
+
 
 
 //----------------------------------------------------------------------------
@@ -168,6 +214,16 @@ void ArchiveFileSystem::loadIntoDirectoryTree(ArchiveFile *archiveFile, Bool ove
 
 		dirInfo->m_files.insert(fileIt, std::make_pair(token, archiveFile));
 
+		Char filePath[MAX_ARCHIVED_FILE_PATH_LEN];
+		if (makeArchivedFilePath(it->str(), filePath, MAX_ARCHIVED_FILE_PATH_LEN))
+		{
+			ArchiveFileList &archives = m_filePathIndex[rts::string_key<AsciiString>(filePath)];
+			if (overwrite)
+				archives.insert(archives.begin(), archiveFile);
+			else
+				archives.push_back(archiveFile);
+		}
+
 #if defined(DEBUG_LOGGING) && ENABLE_FILESYSTEM_LOGGING
 		{
 			const stl::const_range<ArchivedFileLocationMap> range = stl::get_range(dirInfo->m_files, token, 0);
@@ -238,14 +294,7 @@ void ArchiveFileSystem::loadMods()
 
 Bool ArchiveFileSystem::doesFileExist(const Char *filename, FileInstance instance) const
 {
-	ArchivedDirectoryInfoResult result = const_cast<ArchiveFileSystem*>(this)->getArchivedDirectoryInfo(filename);
-
-	if (!result.valid())
-		return false;
-
-	stl::const_range<ArchivedFileLocationMap> range = stl::get_range(result.dirInfo->m_files, result.lastToken, instance);
-
-	return range.valid();
+	return getArchiveFile(filename, instance) != nullptr;
 }
 
 ArchivedDirectoryInfo* ArchiveFileSystem::friend_getArchivedDirectoryInfo(const Char* directory)
@@ -328,7 +377,29 @@ Bool ArchiveFileSystem::getFileInfo(const AsciiString& filename, FileInfo *fileI
 
 ArchiveFile* ArchiveFileSystem::getArchiveFile(const AsciiString& filename, FileInstance instance) const
 {
-	ArchivedDirectoryInfoResult result = const_cast<ArchiveFileSystem*>(this)->getArchivedDirectoryInfo(filename.str());
+	Char filePath[MAX_ARCHIVED_FILE_PATH_LEN];
+	if (!makeArchivedFilePath(filename.str(), filePath, MAX_ARCHIVED_FILE_PATH_LEN))
+		return findArchiveFileInDirectoryTree(filename.str(), instance);
+
+	const ArchiveFileList *archives = findArchiveFileList(filePath);
+	if (archives == nullptr || instance >= archives->size())
+		return nullptr;
+
+	return (*archives)[instance];
+}
+
+const ArchiveFileList* ArchiveFileSystem::findArchiveFileList(const Char* filePath) const
+{
+	ArchivedFilePathMap::const_iterator it = m_filePathIndex.find(rts::string_key<AsciiString>::temporary(filePath));
+	if (it == m_filePathIndex.end())
+		return nullptr;
+
+	return &it->second;
+}
+
+ArchiveFile* ArchiveFileSystem::findArchiveFileInDirectoryTree(const Char* filename, FileInstance instance) const
+{
+	ArchivedDirectoryInfoResult result = const_cast<ArchiveFileSystem*>(this)->getArchivedDirectoryInfo(filename);
 
 	if (!result.valid())
 		return nullptr;
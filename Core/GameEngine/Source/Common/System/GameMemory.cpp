@@ -52,6 +52,7 @@
 #include "Common/Errors.h"
 #include "Common/GlobalData.h"
 #include "Common/PerfTimer.h"
+#include "thread.h"
 #ifdef MEMORYPOOL_DEBUG
 #include "GameClient/ClientRandomValue.h"
 #endif
@@ -212,6 +213,40 @@ static void doStackDump(void **stacktrace, int size);
 #endif
 static void preMainInitMemoryManager();
 
+#ifdef MEMORYPOOL_MAGAZINES
+
+#if defined(_MSC_VER)
+	#define MEMORYPOOL_THREAD_LOCAL __declspec(thread)
+#else
+	#define MEMORYPOOL_THREAD_LOCAL __thread
+#endif
+
+enum
+{
+	MAX_MEMORYPOOL_MAGAZINE_SLOTS = 2048,												///< max number of pools that can use magazines. slots are never reused.
+	MEMORYPOOL_MAGAZINE_SIZE = 32,															///< max number of free blocks a thread caches per pool
+	MEMORYPOOL_MAGAZINE_BATCH = MEMORYPOOL_MAGAZINE_SIZE / 2		///< number of blocks moved between a magazine and its pool at once
+};
+
+/**
+	A thread's cache of free blocks of a single pool. The blocks stay counted as used
+	by their blobs and their pool while they sit in a magazine, so the blobs cannot be
+	released under them.
+*/
+struct MemoryPoolMagazine
+{
+	Int										m_epoch;																///< epoch of the pool when these blocks were taken
+	Int										m_count;																///< number of blocks in m_blocks
+	MemoryPoolSingleBlock	*m_blocks[MEMORYPOOL_MAGAZINE_SIZE];
+};
+
+static MemoryPool *theMagazinePools[MAX_MEMORYPOOL_MAGAZINE_SLOTS];	///< the pool of each slot, or null once that pool was destroyed
+static Int theNextMagazineSlot = 0;
+static Int theNextMagazineEpoch = 0;
+static MEMORYPOOL_THREAD_LOCAL MemoryPoolMagazine **theThreadMagazines = nullptr;	///< magazines of the calling thread, indexed by slot
+
+#endif // MEMORYPOOL_MAGAZINES
+
 // ----------------------------------------------------------------------------
 // PRIVATE FUNCTIONS
 // ----------------------------------------------------------------------------
@@ -1509,6 +1544,10 @@ MemoryPool::MemoryPool() :
 	m_lastBlob(nullptr),
 	m_firstBlobWithFreeBlocks(nullptr)
 {
+#ifdef MEMORYPOOL_MAGAZINES
+	m_magazineSlot = -1;
+	m_magazineEpoch = 0;
+#endif
 }
 
 //-----------------------------------------------------------------------------
@@ -1532,6 +1571,23 @@ void MemoryPool::init(MemoryPoolFactory *factory, const char *poolName, Int allo
 
 	// go ahead and init the initial block here (will throw on failure)
 	createBlob(m_initialAllocationCount);
+
+#ifdef MEMORYPOOL_MAGAZINES
+	{
+		ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+
+		// a pool that cannot grow must be able to hand out every one of its blocks,
+		// so it cannot let threads hold on to free blocks.
+		if (m_magazineSlot < 0 && m_overflowAllocationCount > 0 && theNextMagazineSlot < MAX_MEMORYPOOL_MAGAZINE_SLOTS)
+		{
+			m_magazineSlot = theNextMagazineSlot++;
+			theMagazinePools[m_magazineSlot] = this;
+		}
+
+		// any blocks that threads still cache from before belong to blobs that are gone now.
+		m_magazineEpoch = ++theNextMagazineEpoch;
+	}
+#endif
 }
 
 //-----------------------------------------------------------------------------
@@ -1540,6 +1596,14 @@ void MemoryPool::init(MemoryPoolFactory *factory, const char *poolName, Int allo
 */
 MemoryPool::~MemoryPool()
 {
+#ifdef MEMORYPOOL_MAGAZINES
+	if (m_magazineSlot >= 0)
+	{
+		ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+		theMagazinePools[m_magazineSlot] = nullptr;
+	}
+#endif
+
 	// toss everything. we could do this slightly more efficiently,
 	// but not really worth the extra code to do so.
 	while (m_firstBlob)
@@ -1628,8 +1692,30 @@ Int MemoryPool::freeBlob(MemoryPoolBlob* blob)
 */
 void* MemoryPool::allocateBlockDoNotZeroImplementation(DECLARE_LITERALSTRING_ARG1)
 {
+#ifdef MEMORYPOOL_MAGAZINES
+	MemoryPoolMagazine *magazine = getThreadMagazine();
+	if (magazine)
+	{
+		if (magazine->m_count == 0)
+			refillMagazine(magazine);	// throws on failure
+
+		return magazine->m_blocks[--magazine->m_count]->getUserData();
+	}
+#endif
+
 	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
 
+	return allocateSingleBlockLocked(PASS_LITERALSTRING_ARG1)->getUserData();
+}
+
+//-----------------------------------------------------------------------------
+/**
+	take a free block from the blobs of this pool and do the bookkeeping for it.
+	if unable to allocate, throw ERROR_OUT_OF_MEMORY. this function will never return null.
+	the caller must hold TheMemoryPoolCriticalSection.
+*/
+MemoryPoolSingleBlock *MemoryPool::allocateSingleBlockLocked(DECLARE_LITERALSTRING_ARG1)
+{
 	if (m_firstBlobWithFreeBlocks != nullptr && !m_firstBlobWithFreeBlocks->hasAnyFreeBlocks())
 	{
 		// hmm... the current 'free' blob has nothing available. look and see if there
@@ -1688,7 +1774,7 @@ void* MemoryPool::allocateBlockDoNotZeroImplementation(DECLARE_LITERALSTRING_ARG
 	#endif
 #endif
 
-	return block->getUserData();
+	return block;
 }
 
 //-----------------------------------------------------------------------------
@@ -1713,9 +1799,34 @@ void MemoryPool::freeBlock(void* pBlockPtr)
 	if (!pBlockPtr)
 		return;	// my, that was easy
 
+	MemoryPoolSingleBlock *block = MemoryPoolSingleBlock::recoverBlockFromUserData(pBlockPtr);
+
+#ifdef MEMORYPOOL_MAGAZINES
+	MemoryPoolMagazine *magazine = getThreadMagazine();
+	if (magazine)
+	{
+		DEBUG_ASSERTCRASH(block->getOwningBlob() && block->getOwningBlob()->getOwningPool() == this, ("block does not belong to this pool"));
+
+		if (magazine->m_count == MEMORYPOOL_MAGAZINE_SIZE)
+			flushMagazine(magazine, MEMORYPOOL_MAGAZINE_SIZE - MEMORYPOOL_MAGAZINE_BATCH);
+
+		magazine->m_blocks[magazine->m_count++] = block;
+		return;
+	}
+#endif
+
 	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
 
-	MemoryPoolSingleBlock *block = MemoryPoolSingleBlock::recoverBlockFromUserData(pBlockPtr);
+	freeSingleBlockLocked(block);
+}
+
+//-----------------------------------------------------------------------------
+/**
+	return a block to its blob and do the bookkeeping for it.
+	the caller must hold TheMemoryPoolCriticalSection.
+*/
+void MemoryPool::freeSingleBlockLocked(MemoryPoolSingleBlock *block)
+{
 	MemoryPoolBlob *blob = block->getOwningBlob();
 #ifdef MEMORYPOOL_DEBUG
 	const char* tagString = block->debugGetLiteralTagString();
@@ -1752,6 +1863,88 @@ void MemoryPool::freeBlock(void* pBlockPtr)
 #endif
 }
 
+#ifdef MEMORYPOOL_MAGAZINES
+//-----------------------------------------------------------------------------
+/**
+	return the magazine of the calling thread for this pool, creating it if necessary.
+	returns null if this pool does not use magazines.
+*/
+MemoryPoolMagazine *MemoryPool::getThreadMagazine()
+{
+	if (m_magazineSlot < 0)
+		return nullptr;
+
+	MemoryPoolMagazine **magazines = theThreadMagazines;
+	if (magazines == nullptr)
+	{
+		const Int tableBytes = sizeof(MemoryPoolMagazine *) * MAX_MEMORYPOOL_MAGAZINE_SLOTS;
+		magazines = (MemoryPoolMagazine **)::sysAllocateDoNotZero(tableBytes);	// throws on failure
+		memset(magazines, 0, tableBytes);
+		theThreadMagazines = magazines;
+	}
+
+	MemoryPoolMagazine *magazine = magazines[m_magazineSlot];
+	if (magazine == nullptr)
+	{
+		magazine = (MemoryPoolMagazine *)::sysAllocateDoNotZero(sizeof(MemoryPoolMagazine));	// throws on failure
+		magazine->m_epoch = m_magazineEpoch;
+		magazine->m_count = 0;
+		magazines[m_magazineSlot] = magazine;
+	}
+	else if (magazine->m_epoch != m_magazineEpoch)
+	{
+		// the pool was reset since these blocks were cached, and their blobs are gone.
+		magazine->m_epoch = m_magazineEpoch;
+		magazine->m_count = 0;
+	}
+
+	return magazine;
+}
+
+//-----------------------------------------------------------------------------
+/**
+	move a batch of blocks from the blobs of this pool into the given empty magazine.
+	throws ERROR_OUT_OF_MEMORY if not even one block could be allocated.
+*/
+void MemoryPool::refillMagazine(MemoryPoolMagazine *magazine)
+{
+	DEBUG_ASSERTCRASH(magazine->m_count == 0, ("refilling a magazine that is not empty"));
+
+	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+
+	while (magazine->m_count < MEMORYPOOL_MAGAZINE_BATCH)
+	{
+		magazine->m_blocks[magazine->m_count] = allocateSingleBlockLocked();	// throws on failure
+		++magazine->m_count;
+	}
+}
+
+//-----------------------------------------------------------------------------
+/**
+	return the blocks that were cached first in the given magazine to the blobs of this pool,
+	until keepCount blocks are left. the most recently freed blocks are kept since they are
+	the most likely ones to still be in the cache.
+*/
+void MemoryPool::flushMagazine(MemoryPoolMagazine *magazine, Int keepCount)
+{
+	Int flushCount = magazine->m_count - keepCount;
+	if (flushCount <= 0)
+		return;
+
+	{
+		ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+
+		for (Int i = 0; i < flushCount; ++i)
+		{
+			freeSingleBlockLocked(magazine->m_blocks[i]);
+		}
+	}
+
+	memmove(magazine->m_blocks, magazine->m_blocks + flushCount, keepCount * sizeof(MemoryPoolSingleBlock *));
+	magazine->m_count = keepCount;
+}
+#endif // MEMORYPOOL_MAGAZINES
+
 //-----------------------------------------------------------------------------
 Int MemoryPool::countBlobsInPool()
 {
@@ -2161,7 +2354,14 @@ void DynamicMemoryAllocator::debugIgnoreLeaksForThisBlock(void* pBlockPtr)
 */
 void *DynamicMemoryAllocator::allocateBytesDoNotZeroImplementation(Int numBytes DECLARE_LITERALSTRING_ARG2)
 {
+	MemoryPool *pool = findPoolForSize(numBytes);
+
+#ifdef MEMORYPOOL_MAGAZINES
+	// allocations from the subpools are served by the thread magazines; only the raw block list needs the lock.
+	ScopedCriticalSection scopedCriticalSection(pool ? nullptr : TheDmaCriticalSection);
+#else
 	ScopedCriticalSection scopedCriticalSection(TheDmaCriticalSection);
+#endif
 
 	void *result = nullptr;
 
@@ -2170,7 +2370,6 @@ void *DynamicMemoryAllocator::allocateBytesDoNotZeroImplementation(Int numBytes
 	Int waste = 0;
 #endif
 
-	MemoryPool *pool = findPoolForSize(numBytes);
 	if (pool != nullptr)
 	{
 		result = pool->allocateBlockDoNotZeroImplementation(PASS_LITERALSTRING_ARG1);
@@ -2235,7 +2434,11 @@ void *DynamicMemoryAllocator::allocateBytesDoNotZeroImplementation(Int numBytes
 }
 #endif // MEMORYPOOL_DEBUG
 
+#ifdef MEMORYPOOL_MAGAZINES
+	InterlockedIncrement((volatile LONG *)&m_usedBlocksInDma);
+#else
 	++m_usedBlocksInDma;
+#endif
 	DEBUG_ASSERTCRASH(m_usedBlocksInDma >= 0, ("negative count for m_usedBlocksInDma"));
 #ifdef MEMORYPOOL_DEBUG
 	#ifdef USE_FILLER_VALUE
@@ -2277,13 +2480,18 @@ void DynamicMemoryAllocator::freeBytes(void* pBlockPtr)
 	if (!pBlockPtr)
 		return;
 
+	MemoryPoolSingleBlock *block = MemoryPoolSingleBlock::recoverBlockFromUserData(pBlockPtr);
+
+#ifdef MEMORYPOOL_MAGAZINES
+	// blocks of the subpools go back to the thread magazines; only the raw block list needs the lock.
+	ScopedCriticalSection scopedCriticalSection(block->getOwningBlob() ? nullptr : TheDmaCriticalSection);
+#else
 	ScopedCriticalSection scopedCriticalSection(TheDmaCriticalSection);
+#endif
 
 #ifdef MEMORYPOOL_CHECK_BLOCK_OWNERSHIP
 	DEBUG_ASSERTCRASH(debugIsBlockInDma(pBlockPtr), ("block is not in this dma"));
 #endif
-
-	MemoryPoolSingleBlock *block = MemoryPoolSingleBlock::recoverBlockFromUserData(pBlockPtr);
 #ifdef MEMORYPOOL_DEBUG
 	Int waste = 0, used = 0;
 #ifdef INTENSE_DMA_BOOKKEEPING
@@ -2344,7 +2552,11 @@ void DynamicMemoryAllocator::freeBytes(void* pBlockPtr)
 		::sysFree((void *)block);
 
 	}
+#ifdef MEMORYPOOL_MAGAZINES
+	InterlockedDecrement((volatile LONG *)&m_usedBlocksInDma);
+#else
 	--m_usedBlocksInDma;
+#endif
 	DEBUG_ASSERTCRASH(m_usedBlocksInDma >= 0, ("negative count for m_usedBlocksInDma"));
 
 #ifdef INTENSE_DMA_BOOKKEEPING
@@ -3418,6 +3630,9 @@ void initMemoryManager()
 		TheDynamicMemoryAllocator = TheMemoryPoolFactory->createDynamicMemoryAllocator(numSubPools, pParms);	// will throw on failure
 		userMemoryManagerInitPools();
 		thePreMainInitFlag = false;
+	#ifdef MEMORYPOOL_MAGAZINES
+		ThreadClass::Set_Exit_Callback(releaseThreadMemoryPoolMagazines);
+	#endif
 
 		DEBUG_INIT(DEBUG_FLAGS_DEFAULT);
 		DEBUG_LOG(("*** Initialized the Memory Manager"));
@@ -3494,12 +3709,46 @@ static void preMainInitMemoryManager()
 		TheDynamicMemoryAllocator = TheMemoryPoolFactory->createDynamicMemoryAllocator(numSubPools, pParms);	// will throw on failure
 		userMemoryManagerInitPools();
 		thePreMainInitFlag = true;
+	#ifdef MEMORYPOOL_MAGAZINES
+		ThreadClass::Set_Exit_Callback(releaseThreadMemoryPoolMagazines);
+	#endif
 
 		DEBUG_INIT(DEBUG_FLAGS_DEFAULT);
 		DEBUG_LOG(("*** Initialized the Memory Manager prior to main!"));
 	}
 }
 
+#ifdef MEMORYPOOL_MAGAZINES
+//-----------------------------------------------------------------------------
+void releaseThreadMemoryPoolMagazines()
+{
+	MemoryPoolMagazine **magazines = theThreadMagazines;
+	if (magazines == nullptr)
+		return;
+
+	theThreadMagazines = nullptr;
+
+	// other threads may be destroying pools while this one exits.
+	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+
+	for (Int slot = 0; slot < theNextMagazineSlot; ++slot)
+	{
+		MemoryPoolMagazine *magazine = magazines[slot];
+		if (magazine == nullptr)
+			continue;
+
+		// blocks of destroyed or reset pools are already gone with their blobs.
+		MemoryPool *pool = theMagazinePools[slot];
+		if (pool && magazine->m_epoch == pool->m_magazineEpoch)
+			pool->flushMagazine(magazine, 0);
+
+		::sysFree((void *)magazine);
+	}
+
+	::sysFree((void *)magazines);
+}
+#endif
+
 //-----------------------------------------------------------------------------
 /**
 	shutdown the memory manager and discard all memory. Note: if preMainInitMemoryManager()
@@ -3515,6 +3764,11 @@ void shutdownMemoryManager()
 	}
 	else
 	{
+	#ifdef MEMORYPOOL_MAGAZINES
+		ThreadClass::Set_Exit_Callback(nullptr);
+		releaseThreadMemoryPoolMagazines();
+	#endif
+
 		if (TheDynamicMemoryAllocator)
 		{
 			DEBUG_ASSERTCRASH(TheMemoryPoolFactory, ("hmm, no factory"));
@@ -22,6 +22,7 @@
 #include "Common/MiniDumper.h"
 #include <wctype.h>
 #include "gitinfo.h"
+#include "thread.h"
 
 // Globals for storing the pointer to the exception
 _EXCEPTION_POINTERS* g_dumpException = nullptr;
@@ -336,7 +337,9 @@ DWORD WINAPI MiniDumper::MiniDumpThreadProc(LPVOID lpParam)
 	}
 
 	MiniDumper* dumper = static_cast<MiniDumper *>(lpParam);
-	return dumper->ThreadProcInternal();
+	const DWORD exitCode = dumper->ThreadProcInternal();
+	ThreadClass::Thread_Exiting();
+	return exitCode;
 }
 
 
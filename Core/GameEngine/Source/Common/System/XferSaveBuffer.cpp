@@ -0,0 +1,151 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: XferSaveBuffer.cpp ///////////////////////////////////////////////////////////////////////
+// Desc:   Xfer memory buffer write implementation
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// USER INCLUDES //////////////////////////////////////////////////////////////////////////////////
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+#include "Common/XferSaveBuffer.h"
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+XferSaveBuffer::XferSaveBuffer()
+{
+
+	m_isOpen = FALSE;
+
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+XferSaveBuffer::~XferSaveBuffer()
+{
+
+	DEBUG_ASSERTCRASH( m_blockPositions.empty(), ("XferSaveBuffer::~XferSaveBuffer - Unmatched begin block") );
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Start writing into an empty buffer, the identifier is only used for error messages */
+//-------------------------------------------------------------------------------------------------
+void XferSaveBuffer::open( AsciiString identifier )
+{
+
+	// sanity, check to see if we're already open
+	if( m_isOpen )
+	{
+
+		DEBUG_CRASH(( "Cannot open buffer '%s' cause we've already got '%s' open",
+									identifier.str(), m_identifier.str() ));
+		throw XFER_FILE_ALREADY_OPEN;
+
+	}
+
+	// call base class
+	Xfer::open( identifier );
+
+	m_buffer.clear();
+	m_blockPositions.clear();
+	m_isOpen = TRUE;
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Finish writing, the buffer stays available */
+//-------------------------------------------------------------------------------------------------
+void XferSaveBuffer::close()
+{
+
+	if( !m_isOpen )
+	{
+
+		DEBUG_CRASH(( "Xfer close called, but no buffer was open" ));
+		throw XFER_FILE_NOT_OPEN;
+
+	}
+
+	m_isOpen = FALSE;
+	m_identifier.clear();
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Write a placeholder block size and remember its position for the next endBlock */
+//-------------------------------------------------------------------------------------------------
+Int XferSaveBuffer::beginBlock()
+{
+
+	DEBUG_ASSERTCRASH( m_isOpen, ("Xfer begin block - buffer '%s' is not open", m_identifier.str()) );
+
+	m_blockPositions.push_back( (Int)m_buffer.size() );
+
+	XferBlockSize blockSize = 0;
+	xferImplementation( &blockSize, sizeof( XferBlockSize ) );
+
+	return XFER_OK;
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Write the size in bytes from the last begin block to the current position into its placeholder */
+//-------------------------------------------------------------------------------------------------
+void XferSaveBuffer::endBlock()
+{
+
+	if( m_blockPositions.empty() )
+	{
+
+		DEBUG_CRASH(( "Xfer end block called, but no matching begin block was found" ));
+		throw XFER_BEGIN_END_MISMATCH;
+
+	}
+
+	const Int blockPos = m_blockPositions.back();
+	m_blockPositions.pop_back();
+
+	XferBlockSize blockSize = (Int)m_buffer.size() - blockPos - sizeof( XferBlockSize );
+	memcpy( &m_buffer[ blockPos ], &blockSize, sizeof( XferBlockSize ) );
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Skip forward 'dataSize' bytes, which leaves zeros like seeking past the end of a file does */
+//-------------------------------------------------------------------------------------------------
+void XferSaveBuffer::skip( Int dataSize )
+{
+
+	DEBUG_ASSERTCRASH( m_isOpen, ("XferSaveBuffer - buffer '%s' is not open", m_identifier.str()) );
+
+	m_buffer.resize( m_buffer.size() + dataSize, 0 );
+
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Perform the write operation */
+//-------------------------------------------------------------------------------------------------
+void XferSaveBuffer::xferImplementation( void *data, Int dataSize )
+{
+
+	DEBUG_ASSERTCRASH( m_isOpen, ("XferSaveBuffer - buffer '%s' is not open", m_identifier.str()) );
+
+	const UnsignedByte *bytes = static_cast<const UnsignedByte *>( data );
+	m_buffer.insert( m_buffer.end(), bytes, bytes + dataSize );
+
+}
@@ -46,10 +46,13 @@
 #include "GameClient/ParticleSys.h"
 #include "GameClient/Smudge.h"
 
+#include "GameLogic/FPUControl.h"
 #include "GameLogic/GameLogic.h"
 #include "GameLogic/Object.h"
 #include "GameLogic/TerrainLogic.h"
 
+#include "thread.h"
+
 
 //------------------------------------------------------------------------------ Performance Timers
 //#include "Common/PerfMetrics.h"
@@ -61,6 +64,102 @@
 // the singleton
 ParticleSystemManager *TheParticleSystemManager = nullptr;
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// ParticleUpdateThreadClass //////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Fewest particles worth handing to one thread. Below that, waking the thread costs more than it saves.
+static const Int PARTICLES_PER_UPDATE_JOB = 256;
+
+// ------------------------------------------------------------------------------------------------
+/** Update a slice of particles and note which of them are still alive. Particle::update only
+	* touches the particle itself, so slices of the same system can be updated at the same time. */
+// ------------------------------------------------------------------------------------------------
+static void updateParticleSlice( Particle * const *particles, UnsignedByte *alive, Int begin, Int end,
+																 const ParticleUpdateContext *context )
+{
+	for( Int i = begin; i < end; ++i )
+		alive[ i ] = particles[ i ]->update( *context );
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Worker thread that updates one slice of particles each time it is woken up */
+// ------------------------------------------------------------------------------------------------
+class ParticleUpdateThreadClass : public ThreadClass
+{
+
+public:
+
+	ParticleUpdateThreadClass() : ThreadClass( "ParticleUpdateThread" )
+	{
+		m_jobReady = CreateEvent( nullptr, FALSE, FALSE, nullptr );
+		m_jobDone = CreateEvent( nullptr, FALSE, FALSE, nullptr );
+		m_quit = false;
+		m_particles = nullptr;
+		m_alive = nullptr;
+		m_begin = 0;
+		m_end = 0;
+		m_context = nullptr;
+	}
+
+	virtual ~ParticleUpdateThreadClass() override
+	{
+		CloseHandle( m_jobReady );
+		CloseHandle( m_jobDone );
+	}
+
+	void startJob( Particle * const *particles, UnsignedByte *alive, Int begin, Int end, const ParticleUpdateContext *context )
+	{
+		m_particles = particles;
+		m_alive = alive;
+		m_begin = begin;
+		m_end = end;
+		m_context = context;
+		SetEvent( m_jobReady );
+	}
+
+	void waitForJob()
+	{
+		WaitForSingleObject( m_jobDone, INFINITE );
+	}
+
+	void quit()
+	{
+		m_quit = true;
+		SetEvent( m_jobReady );
+		Stop();
+	}
+
+protected:
+
+	virtual void Thread_Function() override
+	{
+		// the FPU control word is per thread, so match the precision and rounding of the client thread.
+		setFPMode();
+
+		for( ;; )
+		{
+			WaitForSingleObject( m_jobReady, INFINITE );
+			if( m_quit )
+				break;
+
+			updateParticleSlice( m_particles, m_alive, m_begin, m_end, m_context );
+			SetEvent( m_jobDone );
+		}
+	}
+
+	HANDLE m_jobReady;
+	HANDLE m_jobDone;
+	volatile Bool m_quit;
+
+	Particle * const *m_particles;
+	UnsignedByte *m_alive;
+	Int m_begin;
+	Int m_end;
+	const ParticleUpdateContext *m_context;
+
+};
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -371,8 +470,12 @@ void Particle::applyForce( const Coord3D *force )
 // ------------------------------------------------------------------------------------------------
 /** Update the behavior of an individual particle */
 // ------------------------------------------------------------------------------------------------
-Bool Particle::update()
+Bool Particle::update( const ParticleUpdateContext &context )
 {
+	// apply 'gravity' force
+	if (context.m_gravity != 0.0f)
+		m_accel.z += context.m_gravity;
+
 	// integrate acceleration into velocity
 	m_vel.x += m_accel.x;
 	m_vel.y += m_accel.y;
@@ -383,17 +486,14 @@ Bool Particle::update()
 	m_vel.z *= m_velDamping;
 
 	// integrate velocity into position
-	const Coord3D *driftVel = m_system->getDriftVelocity();
+	const Coord3D *driftVel = &context.m_driftVelocity;
 	m_pos.x += m_vel.x + driftVel->x;
 	m_pos.y += m_vel.y + driftVel->y;
 	m_pos.z += m_vel.z + driftVel->z;
 
 	// integrate the wind (if specified) into position
-	ParticleSystemInfo::WindMotion windMotion = m_system->getWindMotion();
-
-	// see if we should even do anything
-	if( windMotion != ParticleSystemInfo::WIND_MOTION_NOT_USED )
-		doWindMotion();
+	if( context.m_useWind )
+		doWindMotion( context );
 
 	// update orientation
 #if PARTICLE_USE_XY_ROTATION
@@ -424,13 +524,13 @@ Bool Particle::update()
 	// Update alpha (if used)
 	//
 
-	if (m_system->getShaderType() != ParticleSystemInfo::ADDITIVE)
+	if (context.m_updateAlpha)
 	{
 		m_alpha += m_alphaRate;
 
 		if (m_alphaTargetKey < MAX_KEYFRAMES && m_alphaKey[ m_alphaTargetKey ].frame)
 		{
-			if (TheGameClient->getFrame() - m_createTimestamp >= m_alphaKey[ m_alphaTargetKey ].frame)
+			if (context.m_frame - m_createTimestamp >= m_alphaKey[ m_alphaTargetKey ].frame)
 			{
 				m_alpha = m_alphaKey[ m_alphaTargetKey ].value;
 				m_alphaTargetKey++;
@@ -456,7 +556,7 @@ Bool Particle::update()
 
 	if (m_colorTargetKey < MAX_KEYFRAMES && m_colorKey[ m_colorTargetKey ].frame)
 	{
-		if (TheGameClient->getFrame() - m_createTimestamp >= m_colorKey[ m_colorTargetKey ].frame)
+		if (context.m_frame - m_createTimestamp >= m_colorKey[ m_colorTargetKey ].frame)
 		{
 			// can't set, because of colorscale
 			// m_color = m_colorKey[ m_colorTargetKey ].color;
@@ -512,47 +612,10 @@ Bool Particle::update()
 // ------------------------------------------------------------------------------------------------
 /** Do wind motion as specified by the particle system template, if present */
 // ------------------------------------------------------------------------------------------------
-void Particle::doWindMotion()
+void Particle::doWindMotion( const ParticleUpdateContext &context )
 {
-
-	// get the angle of the wind
-	Real windAngle = m_system->getWindAngle();
-
-	// get the system position
-	Coord3D systemPos;
-	m_system->getPosition( &systemPos );
-
-	// when we're attached objects and drawables we offset by that position as well
-	if( ObjectID attachedObj = m_system->getAttachedObject() )
-	{
-		Object *obj = TheGameLogic->findObjectByID( attachedObj );
-
-		if( obj )
-		{
-			const Coord3D *objPos = obj->getPosition();
-
-			systemPos.x += objPos->x;
-			systemPos.y += objPos->y;
-			systemPos.z += objPos->z;
-
-		}
-
-	}
-	else if( DrawableID attachedDraw = m_system->getAttachedDrawable() )
-	{
-		Drawable *draw = TheGameClient->findDrawableByID( attachedDraw );
-
-		if( draw )
-		{
-			const Coord3D *drawPos = draw->getPosition();
-
-			systemPos.x += drawPos->x;
-			systemPos.y += drawPos->y;
-			systemPos.z += drawPos->z;
-
-		}
-
-	}
+	// the system position in the world, including the object or drawable we are attached to
+	const Coord3D &systemPos = context.m_windOrigin;
 
 	//
 	// compute a vector from the system position in the world to the particle ... we will use
@@ -584,8 +647,8 @@ void Particle::doWindMotion()
 																		(noForceDistance - fullForceDistance)));
 
 		// integrate the wind motion into the position
-		m_pos.x += (Cos( windAngle ) * windForceStrength);
-		m_pos.y += (Sin( windAngle ) * windForceStrength);
+		m_pos.x += (context.m_windCos * windForceStrength);
+		m_pos.y += (context.m_windSin * windForceStrength);
 
 	}
 
@@ -2096,30 +2159,9 @@ Bool ParticleSystem::update( Int localPlayerIndex  )
 	//
 	// Update all particles in the system
 	//
-	Particle *p = m_systemParticlesHead;
-	Particle *oldParticle;
-	while (p)
-	{
-
-		// apply 'gravity' force
-		if (m_gravity != 0.0f)
-		{
-			Coord3D force;
-			force.x = 0.0f;
-			force.y = 0.0f;
-			force.z = m_gravity;
-			p->applyForce( &force );
-		}
-
-		if (p->update() == false)
-		{
-			oldParticle = p;
-			p = p->m_systemNext;
-			deleteInstance(oldParticle);
-		} else {
-			p = p->m_systemNext;
-		}
-	}
+	ParticleUpdateContext context;
+	computeParticleUpdateContext( &context );
+	updateParticles( context );
 
 	//
 	// If we have been "destroyed", wait for all of our particles to die off,
@@ -2148,6 +2190,85 @@ Bool ParticleSystem::update( Int localPlayerIndex  )
 	return true;
 }
 
+// ------------------------------------------------------------------------------------------------
+/** Update all particles of this system and destroy the ones that died */
+// ------------------------------------------------------------------------------------------------
+void ParticleSystem::updateParticles( const ParticleUpdateContext &context )
+{
+	if (TheParticleSystemManager->friend_updateParticlesOnThreads( m_systemParticlesHead, getParticleCount(), context ))
+		return;
+
+	Particle *p = m_systemParticlesHead;
+	Particle *oldParticle;
+	while (p)
+	{
+		if (p->update( context ) == false)
+		{
+			oldParticle = p;
+			p = p->m_systemNext;
+			deleteInstance(oldParticle);
+		} else {
+			p = p->m_systemNext;
+		}
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Gather the values that all particles of this system share during this update */
+// ------------------------------------------------------------------------------------------------
+void ParticleSystem::computeParticleUpdateContext( ParticleUpdateContext *context )
+{
+	context->m_driftVelocity = m_driftVelocity;
+	context->m_gravity = m_gravity;
+	context->m_frame = TheGameClient->getFrame();
+	context->m_updateAlpha = (m_shaderType != ParticleSystemInfo::ADDITIVE);
+	context->m_useWind = (m_windMotion != ParticleSystemInfo::WIND_MOTION_NOT_USED);
+
+	if( context->m_useWind == false )
+		return;
+
+	context->m_windCos = Cos( m_windAngle );
+	context->m_windSin = Sin( m_windAngle );
+
+	// get the system position
+	Coord3D systemPos;
+	getPosition( &systemPos );
+
+	// when we're attached objects and drawables we offset by that position as well
+	if( m_attachedToObjectID )
+	{
+		Object *obj = TheGameLogic->findObjectByID( m_attachedToObjectID );
+
+		if( obj )
+		{
+			const Coord3D *objPos = obj->getPosition();
+
+			systemPos.x += objPos->x;
+			systemPos.y += objPos->y;
+			systemPos.z += objPos->z;
+
+		}
+
+	}
+	else if( m_attachedToDrawableID )
+	{
+		Drawable *draw = TheGameClient->findDrawableByID( m_attachedToDrawableID );
+
+		if( draw )
+		{
+			const Coord3D *drawPos = draw->getPosition();
+
+			systemPos.x += drawPos->x;
+			systemPos.y += drawPos->y;
+			systemPos.z += drawPos->z;
+
+		}
+
+	}
+
+	context->m_windOrigin = systemPos;
+}
+
 // ------------------------------------------------------------------------------------------------
 /** Update the wind motion */
 // ------------------------------------------------------------------------------------------------
@@ -2890,6 +3011,7 @@ ParticleSystemManager::ParticleSystemManager()
 	m_particleCount = 0;
 	m_fieldParticleCount = 0;
 	m_particleSystemCount = 0;
+	m_updateTimeLastFrame = 0.0f;
 
 	for( Int i = 0; i < NUM_PARTICLE_PRIORITIES; ++i )
 	{
@@ -2906,6 +3028,7 @@ ParticleSystemManager::ParticleSystemManager()
 ParticleSystemManager::~ParticleSystemManager()
 {
 	reset();
+	stopUpdateThreads();
 
 	TemplateMap::iterator begin(m_templateMap.begin());
 	TemplateMap::iterator end(m_templateMap.end());
@@ -2937,6 +3060,35 @@ void ParticleSystemManager::init()
 
 	}
 
+	startUpdateThreads();
+
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Start the worker threads that help updating the particles of large systems */
+// ------------------------------------------------------------------------------------------------
+void ParticleSystemManager::startUpdateThreads()
+{
+	stopUpdateThreads();
+
+	for( Int i = 0; i < TheGlobalData->m_particleUpdateThreads; ++i )
+	{
+		ParticleUpdateThreadClass *thread = NEW ParticleUpdateThreadClass;
+		thread->Execute();
+		m_updateThreads.push_back( thread );
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------
+void ParticleSystemManager::stopUpdateThreads()
+{
+	for( UpdateThreadVec::iterator it = m_updateThreads.begin(); it != m_updateThreads.end(); ++it )
+	{
+		(*it)->quit();
+		delete *it;
+	}
+	m_updateThreads.clear();
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -2979,7 +3131,7 @@ void ParticleSystemManager::reset()
 // ------------------------------------------------------------------------------------------------
 /** Update all particle systems */
 // ------------------------------------------------------------------------------------------------
-//DECLARE_PERF_TIMER(ParticleSystemManager)
+DECLARE_PERF_TIMER(ParticleSystemManager)
 void ParticleSystemManager::update()
 {
 	if (m_lastLogicFrameUpdate == TheGameLogic->getFrame()) {
@@ -2989,7 +3141,11 @@ void ParticleSystemManager::update()
 	// update the last logic frame.
 	m_lastLogicFrameUpdate = TheGameLogic->getFrame();
 
-	//USE_PERF_TIMER(ParticleSystemManager)
+	USE_PERF_TIMER(ParticleSystemManager)
+	__int64 startTime64, endTime64, freq64;
+	QueryPerformanceFrequency( (LARGE_INTEGER *)&freq64 );
+	QueryPerformanceCounter( (LARGE_INTEGER *)&startTime64 );
+
 	ParticleSystemListIt it = m_allParticleSystemList.begin();
 	while( it != m_allParticleSystemList.end() )
 	{
@@ -3039,6 +3195,52 @@ void ParticleSystemManager::update()
 			}
 		}
 	}
+
+	QueryPerformanceCounter( (LARGE_INTEGER *)&endTime64 );
+	m_updateTimeLastFrame = (Real)((double)(endTime64 - startTime64) / (double)freq64);
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Split the particles of a system into slices and update them on this thread and the worker
+	* threads at the same time. The dead ones are destroyed afterwards, in list order, which gives
+	* the same result as the serial loop in ParticleSystem::updateParticles. */
+// ------------------------------------------------------------------------------------------------
+Bool ParticleSystemManager::friend_updateParticlesOnThreads( Particle *firstParticle, Int particleCount,
+																														const ParticleUpdateContext &context )
+{
+	Int jobCount = min( (Int)m_updateThreads.size() + 1, particleCount / PARTICLES_PER_UPDATE_JOB );
+	if( jobCount < 2 )
+		return FALSE;
+
+	m_updateParticles.resize( particleCount );
+	m_updateParticleAlive.resize( particleCount );
+
+	Int count = 0;
+	for( Particle *p = firstParticle; p && count < particleCount; p = p->m_systemNext )
+		m_updateParticles[ count++ ] = p;
+	DEBUG_ASSERTCRASH( count == particleCount, ("Particle system has %d particles in its list, but counts %d", count, particleCount) );
+
+	Particle * const *particles = &m_updateParticles[ 0 ];
+	UnsignedByte *alive = &m_updateParticleAlive[ 0 ];
+	Int sliceSize = (count + jobCount - 1) / jobCount;
+
+	// the first slice is ours, the others go to the workers
+	Int job;
+	for( job = 1; job < jobCount; ++job )
+		m_updateThreads[ job - 1 ]->startJob( particles, alive, min( count, job * sliceSize ), min( count, (job + 1) * sliceSize ), &context );
+
+	updateParticleSlice( particles, alive, 0, min( count, sliceSize ), &context );
+
+	for( job = 1; job < jobCount; ++job )
+		m_updateThreads[ job - 1 ]->waitForJob();
+
+	for( Int i = 0; i < count; ++i )
+	{
+		if( alive[ i ] == false )
+			deleteInstance( m_updateParticles[ i ] );
+	}
+
+	return TRUE;
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -1118,6 +1118,7 @@ void PathfindCellInfo::forceCleanPathFindCellInfos()
 	for (Int i = 0; i < CELL_INFOS_TO_ALLOCATE - 1; i++) {
 		s_infoArray[i].m_nextOpen = nullptr;
 		s_infoArray[i].m_prevOpen = nullptr;
+		s_infoArray[i].m_openHeapIndex = -1;
 		s_infoArray[i].m_open = FALSE;
 		s_infoArray[i].m_closed = FALSE;
 	}
@@ -1204,6 +1205,7 @@ PathfindCellInfo *PathfindCellInfo::getACellInfo(PathfindCell *cell,const ICoord
 
 		info->m_nextOpen = nullptr;
 		info->m_prevOpen = nullptr;
+		info->m_openHeapIndex = -1;
 		info->m_pathParent = nullptr;
 		info->m_costSoFar = 0;
 		info->m_totalCost = 0;
@@ -1235,12 +1237,14 @@ void PathfindCellInfo::releaseACellInfo(PathfindCellInfo *theInfo)
 
 //-----------------------------------------------------------------------------------
 
-Bool PathfindCellList::canReverseSort(PathfindCell& currentCell) const
+PathfindCell* PathfindCellList::getNext(PathfindCell* cell) const
 {
-	if (m_head && m_tail)
-		return m_head->getTotalCostDifference(currentCell) > m_tail->getTotalCostDifference(currentCell);
+	const Int heapIndex = cell->getOpenHeapIndex();
+	if (heapIndex < 0)
+		return cell->getNextOpen();
 
-	return false;
+	const size_t nextIndex = (size_t)heapIndex + 1;
+	return nextIndex < m_heap.size() ? m_heap[nextIndex].m_cell : nullptr;
 }
 
 //-----------------------------------------------------------------------------------
@@ -1348,18 +1352,6 @@ inline void PathfindCell::setBlockedByAlly(Bool blocked)
 #endif
 }
 
-/**
- * Determine absolute total path cost difference between two cells.
- * Returns UINT_MAX if used with an uninitialised cell, so will be sorted as maximally dissimilar.
- */
-inline UnsignedInt PathfindCell::getTotalCostDifference(PathfindCell& other) const
-{
-	if (m_info && other.m_info)
-		return abs((Int)m_info->m_totalCost - (Int)other.m_info->m_totalCost);
-
-	return UINT_MAX;
-}
-
 /**
  * Set the parent pointer.
  */
@@ -1756,8 +1748,8 @@ void PathfindCell::forwardInsertionSortRetailCompatible(PathfindCellList& list)
 }
 #endif
 
-// Forward insertion sort, returns early if the list is being initialized or we are prepending the list
-void PathfindCell::forwardInsertionSort(PathfindCellList& list)
+// Push onto the open list heap, ordered by total cost and then by insertion order
+void PathfindCell::pushOnOpenHeap(PathfindCellList& list)
 {
 	DEBUG_ASSERTCRASH(m_info, ("Has to have info."));
 	DEBUG_ASSERTCRASH(m_info->m_closed == FALSE && m_info->m_open == FALSE, ("Serious error - Invalid flags. jba"));
@@ -1765,87 +1757,79 @@ void PathfindCell::forwardInsertionSort(PathfindCellList& list)
 	// mark the new cell as being on the open list
 	m_info->m_open = true;
 	m_info->m_closed = false;
+	m_info->m_prevOpen = nullptr;
+	m_info->m_nextOpen = nullptr;
 
-	if (list.m_head == nullptr) {
-		m_info->m_prevOpen = nullptr;
-		m_info->m_nextOpen = nullptr;
-		list.m_head = this;
-		list.m_tail = this;
-		return;
-	}
-
-	// If the node needs inserting before the current list head
-	if (m_info->m_totalCost < list.m_head->m_info->m_totalCost) {
-		m_info->m_prevOpen = nullptr;
-		list.m_head->m_info->m_prevOpen = this->m_info;
-		m_info->m_nextOpen = list.m_head->m_info;
-		list.m_head = this;
-		return;
-	}
-
-	// Traverse the list to find correct position
-	PathfindCell* current = list.m_head;
-	while (current->m_info->m_nextOpen && current->m_info->m_nextOpen->m_totalCost <= m_info->m_totalCost) {
-		current = current->getNextOpen();
-	}
-
-	// Insert the new node in the correct position
-	m_info->m_nextOpen = current->m_info->m_nextOpen;
-	if (current->m_info->m_nextOpen != nullptr) {
-		current->m_info->m_nextOpen->m_prevOpen = this->m_info;
-	}
-	else {
-		list.m_tail = this;
-	}
+	PathfindCellList::OpenHeapEntry entry;
+	entry.m_totalCost = m_info->m_totalCost;
+	entry.m_order = list.m_nextOpenOrder++;
+	entry.m_cell = this;
 
-	current->m_info->m_nextOpen = this->m_info;
-	m_info->m_prevOpen = current->m_info;
+	const Int index = (Int)list.m_heap.size();
+	m_info->m_openHeapIndex = index;
+	list.m_heap.push_back(entry);
+	siftUpOpenHeap(list, index);
 }
 
-// Reverse insertion sort, returns early if the list is being initialized or we are appending the list
-void PathfindCell::reverseInsertionSort(PathfindCellList& list)
+// Remove from anywhere in the open list heap
+void PathfindCell::removeFromOpenHeap(PathfindCellList& list)
 {
-	DEBUG_ASSERTCRASH(m_info, ("Has to have info."));
-	DEBUG_ASSERTCRASH(m_info->m_closed == FALSE && m_info->m_open == FALSE, ("Serious error - Invalid flags. jba"));
+	const Int index = m_info->m_openHeapIndex;
+	DEBUG_ASSERTCRASH(index >= 0 && index < (Int)list.m_heap.size() && list.m_heap[index].m_cell == this, ("Bad open list heap index"));
 
-	// mark the new cell as being on the open list
-	m_info->m_open = true;
-	m_info->m_closed = false;
+	m_info->m_openHeapIndex = -1;
 
-	if (list.m_tail == nullptr) {
-		m_info->m_prevOpen = nullptr;
-		m_info->m_nextOpen = nullptr;
-		list.m_tail = this;
-		list.m_head = this;
-		return;
-	}
+	const Int lastIndex = (Int)list.m_heap.size() - 1;
+	if (index != lastIndex) {
+		list.m_heap[index] = list.m_heap[lastIndex];
+		list.m_heap[index].m_cell->m_info->m_openHeapIndex = index;
+		list.m_heap.pop_back();
 
-	// If the node needs inserting after the current list tail
-	if (m_info->m_totalCost >= list.m_tail->m_info->m_totalCost) {
-		m_info->m_prevOpen = list.m_tail->m_info;
-		list.m_tail->m_info->m_nextOpen = this->m_info;
-		m_info->m_nextOpen = nullptr;
-		list.m_tail = this;
-		return;
+		if (index > 0 && list.m_heap[index] < list.m_heap[(index - 1) / 2]) {
+			siftUpOpenHeap(list, index);
+		}
+		else {
+			siftDownOpenHeap(list, index);
+		}
 	}
-
-	// Traverse the list to find correct position
-	PathfindCell* current = list.m_tail;
-	while (current->m_info->m_prevOpen && current->m_info->m_prevOpen->m_totalCost > m_info->m_totalCost) {
-		current = current->getPrevOpen();
+	else {
+		list.m_heap.pop_back();
 	}
+}
 
-	// Insert the new node in the correct position
-	m_info->m_prevOpen = current->m_info->m_prevOpen;
-	if (current->m_info->m_prevOpen != nullptr) {
-		current->m_info->m_prevOpen->m_nextOpen = this->m_info;
-	}
-	else {
-		list.m_head = this;
+void PathfindCell::siftUpOpenHeap(PathfindCellList& list, Int index)
+{
+	PathfindCellList::OpenHeapEntry entry = list.m_heap[index];
+	while (index > 0) {
+		const Int parent = (index - 1) / 2;
+		if (!(entry < list.m_heap[parent]))
+			break;
+		list.m_heap[index] = list.m_heap[parent];
+		list.m_heap[index].m_cell->m_info->m_openHeapIndex = index;
+		index = parent;
 	}
+	list.m_heap[index] = entry;
+	entry.m_cell->m_info->m_openHeapIndex = index;
+}
 
-	current->m_info->m_prevOpen = this->m_info;
-	m_info->m_nextOpen = current->m_info;
+void PathfindCell::siftDownOpenHeap(PathfindCellList& list, Int index)
+{
+	const Int count = (Int)list.m_heap.size();
+	PathfindCellList::OpenHeapEntry entry = list.m_heap[index];
+	for (;;) {
+		Int child = index * 2 + 1;
+		if (child >= count)
+			break;
+		if (child + 1 < count && list.m_heap[child + 1] < list.m_heap[child])
+			child++;
+		if (!(list.m_heap[child] < entry))
+			break;
+		list.m_heap[index] = list.m_heap[child];
+		list.m_heap[index].m_cell->m_info->m_openHeapIndex = index;
+		index = child;
+	}
+	list.m_heap[index] = entry;
+	entry.m_cell->m_info->m_openHeapIndex = index;
 }
 
 /// put self on "open" list in ascending cost order, return new list
@@ -1858,15 +1842,9 @@ void PathfindCell::putOnSortedOpenList( PathfindCellList &list )
 	}
 #endif
 
-	// TheSuperHackers @performance Mauller 20/03/2026 Implement reverse insertion sorting.
-	// Long and complex paths often append PathfindCell's, with high total path costs, to the open list.
-	// Appending and reverse traversal allow faster insertion of these cells, reducing pathfinding overhead by 50 - 66%.
-	if (list.canReverseSort(*this)) {
-		reverseInsertionSort(list);
-	}
-	else {
-		forwardInsertionSort(list);
-	}
+	// Ronin @performance 16/10/2026 Replace the forward and reverse insertion sorts with a binary heap.
+	// The insertion sorts walk a large part of the open list on long paths, the heap inserts and removes in logarithmic time.
+	pushOnOpenHeap(list);
 }
 
 /// remove self from "open" list
@@ -1874,11 +1852,14 @@ void PathfindCell::removeFromOpenList( PathfindCellList &list )
 {
 	DEBUG_ASSERTCRASH(m_info, ("Has to have info."));
 	DEBUG_ASSERTCRASH(m_info->m_closed==FALSE && m_info->m_open==TRUE, ("Serious error - Invalid flags. jba"));
+	if (m_info->m_openHeapIndex >= 0) {
+		removeFromOpenHeap(list);
+		m_info->m_open = false;
+		return;
+	}
+
 	if (m_info->m_nextOpen)
 		m_info->m_nextOpen->m_prevOpen = m_info->m_prevOpen;
-	else {
-		list.m_tail = getPrevOpen();
-	}
 
 	if (m_info->m_prevOpen)
 		m_info->m_prevOpen->m_nextOpen = m_info->m_nextOpen;
@@ -1895,6 +1876,18 @@ void PathfindCell::removeFromOpenList( PathfindCellList &list )
 Int PathfindCell::releaseOpenList( PathfindCellList &list )
 {
 	Int count = 0;
+	for (size_t i = 0; i < list.m_heap.size(); ++i) {
+		count++;
+		PathfindCell *cur = list.m_heap[i].m_cell;
+		PathfindCellInfo *curInfo = cur->m_info;
+		DEBUG_ASSERTCRASH(curInfo, ("Has to have info."));
+		DEBUG_ASSERTCRASH(curInfo->m_closed==FALSE && curInfo->m_open==TRUE, ("Serious error - Invalid flags. jba"));
+		curInfo->m_openHeapIndex = -1;
+		curInfo->m_open = FALSE;
+		cur->releaseInfo();
+	}
+	list.m_heap.clear();
+
 	while (list.m_head) {
 		count++;
 		DEBUG_ASSERTCRASH(list.m_head->m_info, ("Has to have info."));
@@ -2546,6 +2539,7 @@ void ZoneBlock::allocateZones()
 //------------------------  PathfindZoneManager  -------------------------------
 PathfindZoneManager::PathfindZoneManager() : m_maxZone(0),
 m_nextFrameToCalculateZones(0),
+m_zonesVersion(0),
 m_groundCliffZones(nullptr),
 m_groundWaterZones(nullptr),
 m_groundRubbleZones(nullptr),
@@ -2646,6 +2640,7 @@ void PathfindZoneManager::reset()  ///< Called when the map is reset.
 {
 	freeZones();
 	freeBlocks();
+	++m_zonesVersion;
 }
 
 
@@ -2671,6 +2666,7 @@ void PathfindZoneManager::markZonesDirty()  ///< Called when the zones need to b
  */
 void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer layers[], const IRegion2D &globalBounds )
 {
+	++m_zonesVersion;
 #ifdef DEBUG_QPF
 #if defined(DEBUG_LOGGING)
 	__int64 startTime64;
@@ -3017,6 +3013,7 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
  */
 void PathfindZoneManager::updateZonesForModify(PathfindCell **map, PathfindLayer layers[], const IRegion2D &structureBounds, const IRegion2D &globalBounds )
 {
+	++m_zonesVersion;
 
 #ifdef DEBUG_QPF
 #if defined(DEBUG_LOGGING)
@@ -3178,6 +3175,38 @@ void PathfindZoneManager::setAllPassable()
 	}
 }
 
+//
+// Collect the indices of the blocks that are marked passable.
+//
+void PathfindZoneManager::getPassableBlocks(std::vector<Int> &blocks) const
+{
+	blocks.clear();
+	Int blockX;
+	Int blockY;
+	for (blockX = 0; blockX<m_zoneBlockExtent.x; blockX++) {
+		for (blockY = 0; blockY<m_zoneBlockExtent.y; blockY++) {
+			if (m_zoneBlocks[blockX][blockY].isPassable()) {
+				blocks.push_back(blockX*m_zoneBlockExtent.y + blockY);
+			}
+		}
+	}
+}
+
+//
+// Mark exactly the blocks with the given indices passable.
+//
+void PathfindZoneManager::setPassableBlocks(const std::vector<Int> &blocks)
+{
+	clearPassableFlags();
+	for (size_t i = 0; i < blocks.size(); ++i) {
+		Int blockX = blocks[i] / m_zoneBlockExtent.y;
+		Int blockY = blocks[i] % m_zoneBlockExtent.y;
+		if (blockX < m_zoneBlockExtent.x) {
+			m_zoneBlocks[blockX][blockY].setPassable(true);
+		}
+	}
+}
+
 //
 // Set the passable flag for the block at this location.
 //
@@ -4083,6 +4112,21 @@ void Pathfinder::reset()
 	}
 	m_queuePRHead = 0;
 	m_queuePRTail = 0;
+	m_isQueuedForPath.clear();
+
+#if !RETAIL_COMPATIBLE_CRC
+	m_hierarchicalPathCache.clear();
+	m_hierarchicalPathCacheZonesVersion = 0;
+	m_hierarchicalPathCacheExtent.lo.x = m_hierarchicalPathCacheExtent.lo.y = 0;
+	m_hierarchicalPathCacheExtent.hi.x = m_hierarchicalPathCacheExtent.hi.y = 0;
+#endif
+	m_hierarchicalPathCacheHits = 0;
+	m_hierarchicalPathCacheMisses = 0;
+	m_hierarchicalPathCacheCellsSaved = 0;
+
+	m_queueStatsPaths = 0;
+	m_queueStatsCells = 0;
+	m_queueStatsTime = 0;
 
 	m_numWallPieces = 0;
 	for (i=0; i<MAX_WALL_PIECES; ++i)
@@ -4893,7 +4937,7 @@ void Pathfinder::debugShowSearch(  Bool pathFound  )
 		addIcon(nullptr, 0, 0, color);	 // erase.
 	}
 
-	for( s = m_openList.getHead(); s; s=s->getNextOpen() )
+	for( s = m_openList.getHead(); s; s=m_openList.getNext(s) )
 	{
 		// create objects to show path - they decay
 		RGBColor color;
@@ -5825,15 +5869,10 @@ Bool Pathfinder::queueForPath(ObjectID id)
 #endif
 
 	/* Check & see if we are already queued. */
-	Int slot = m_queuePRHead;
-	while (slot != m_queuePRTail) {
-		if (m_queuedPathfindRequests[slot] == id) {
-			return true;
-		}
-		slot++;
-		if (slot >= PATHFIND_QUEUE_LEN) {
-			slot = 0;
-		}
+	// Ronin @performance 16/10/2026 Look up the queued flag by id instead of scanning the whole queue.
+	const size_t idIndex = (size_t)id;
+	if (idIndex < m_isQueuedForPath.size() && m_isQueuedForPath[idIndex]) {
+		return true;
 	}
 
 	// Tail is the first available slot.
@@ -5847,6 +5886,10 @@ Bool Pathfinder::queueForPath(ObjectID id)
 	}
 	m_queuedPathfindRequests[m_queuePRTail] = id;
 	m_queuePRTail = nextSlot;
+	if (idIndex >= m_isQueuedForPath.size()) {
+		m_isQueuedForPath.resize(idIndex + 1, false);
+	}
+	m_isQueuedForPath[idIndex] = true;
 	return true;
 }
 
@@ -6071,12 +6114,18 @@ void Pathfinder::processPathfindQueue()
 	bounds.hi.y--;
 	m_logicalExtent = bounds;
 
+	LARGE_INTEGER queueStartTime;
+	QueryPerformanceCounter(&queueStartTime);
+
 	m_cumulativeCellsAllocated = 0;	// Number of pathfind cells examined.
 	Int pathsFound = 0;
 	while (m_cumulativeCellsAllocated < PATHFIND_CELLS_PER_FRAME &&
 		m_queuePRTail!=m_queuePRHead) {
-		Object *obj = TheGameLogic->findObjectByID(m_queuedPathfindRequests[m_queuePRHead]);
+		const ObjectID id = m_queuedPathfindRequests[m_queuePRHead];
+		Object *obj = TheGameLogic->findObjectByID(id);
 		m_queuedPathfindRequests[m_queuePRHead] = INVALID_ID;
+		// Clear the flag before the pathfind, because the object may queue itself again from doPathfind.
+		m_isQueuedForPath[(size_t)id] = false;
 		if (obj) {
 			AIUpdateInterface *ai = obj->getAIUpdateInterface();
 			if (ai) {
@@ -6090,6 +6139,12 @@ void Pathfinder::processPathfindQueue()
 		}
 	}
 	if (pathsFound > 0) {
+		LARGE_INTEGER queueEndTime;
+		QueryPerformanceCounter(&queueEndTime);
+		m_queueStatsPaths += pathsFound;
+		m_queueStatsCells += m_cumulativeCellsAllocated;
+		m_queueStatsTime += queueEndTime.QuadPart - queueStartTime.QuadPart;
+
 		PROFILER_PLOT("PathfindCells", (double)m_cumulativeCellsAllocated);
 		PROFILER_PLOT("PathfindPaths", (double)pathsFound);
 	}
@@ -6508,11 +6563,29 @@ Path *Pathfinder::findPath( Object *obj, const LocomotorSet& locomotorSet, const
 	}
 
 	m_zoneManager.clearPassableFlags();
-	Path *hPat = findHierarchicalPath(isHuman, locomotorSet, from, rawTo, false);
-	if (hPat) {
-		deleteInstance(hPat);
-	}	else {
-		m_zoneManager.setAllPassable();
+#if !RETAIL_COMPATIBLE_CRC
+	HierarchicalPathCacheKey cacheKey;
+	const Bool useCache = makeHierarchicalPathCacheKey(isHuman, locomotorSet, from, rawTo, cacheKey);
+	if (!useCache || !applyCachedHierarchicalPath(cacheKey, from))
+#endif
+	{
+#if !RETAIL_COMPATIBLE_CRC
+		const Int cellsBefore = m_cumulativeCellsAllocated;
+#endif
+		Path *hPat = findHierarchicalPath(isHuman, locomotorSet, from, rawTo, false);
+		const Bool found = hPat != nullptr;
+		if (hPat) {
+			deleteInstance(hPat);
+		}	else {
+			m_zoneManager.setAllPassable();
+		}
+#if !RETAIL_COMPATIBLE_CRC
+		if (useCache) {
+			addHierarchicalPathCacheEntry(cacheKey, found, m_cumulativeCellsAllocated - cellsBefore);
+		}
+#else
+		(void)found;
+#endif
 	}
 
 	Path *pat = internalFindPath(obj, locomotorSet, from, rawTo);
@@ -6945,24 +7018,7 @@ Path *Pathfinder::buildHierarchicalPath( const Coord3D *fromPos, PathfindCell *g
 	prependCells(path, fromPos, goalCell, true);
 
 #if !(RTS_GENERALS && RETAIL_COMPATIBLE_PATHFINDING)
-	// Expand the hierarchical path around the starting point. jba [8/24/2003]
-	// This allows the unit to get around friendly units that may be near it.
-	Coord3D pos = *path->getFirstNode()->getPosition();
-	Coord3D minPos = pos;
-	minPos.x -= PathfindZoneManager::ZONE_BLOCK_SIZE*PATHFIND_CELL_SIZE_F;
-	minPos.y -= PathfindZoneManager::ZONE_BLOCK_SIZE*PATHFIND_CELL_SIZE_F;
-	Coord3D maxPos = pos;
-	maxPos.x += PathfindZoneManager::ZONE_BLOCK_SIZE*PATHFIND_CELL_SIZE_F;
-	maxPos.y += PathfindZoneManager::ZONE_BLOCK_SIZE*PATHFIND_CELL_SIZE_F;
-	ICoord2D cellNdxMin, cellNdxMax;
-	worldToCell(&minPos, &cellNdxMin);
-	worldToCell(&maxPos, &cellNdxMax);
-	Int i, j;
-	for (i=cellNdxMin.x; i<=cellNdxMax.x; i++) {
-		for (j=cellNdxMin.y; j<=cellNdxMax.y; j++) {
-			m_zoneManager.setPassable(i, j, true);
-		}
-	}
+	setPassableAroundStart(path->getFirstNode()->getPosition());
 #endif
 
 #if defined(RTS_DEBUG)
@@ -6995,6 +7051,146 @@ Path *Pathfinder::buildHierarchicalPath( const Coord3D *fromPos, PathfindCell *g
 }
 
 
+/**
+ * Expand the hierarchical path around the starting point. jba [8/24/2003]
+ * This allows the unit to get around friendly units that may be near it.
+ */
+void Pathfinder::setPassableAroundStart( const Coord3D *startPos )
+{
+	Coord3D minPos = *startPos;
+	minPos.x -= PathfindZoneManager::ZONE_BLOCK_SIZE*PATHFIND_CELL_SIZE_F;
+	minPos.y -= PathfindZoneManager::ZONE_BLOCK_SIZE*PATHFIND_CELL_SIZE_F;
+	Coord3D maxPos = *startPos;
+	maxPos.x += PathfindZoneManager::ZONE_BLOCK_SIZE*PATHFIND_CELL_SIZE_F;
+	maxPos.y += PathfindZoneManager::ZONE_BLOCK_SIZE*PATHFIND_CELL_SIZE_F;
+	ICoord2D cellNdxMin, cellNdxMax;
+	worldToCell(&minPos, &cellNdxMin);
+	worldToCell(&maxPos, &cellNdxMax);
+	Int i, j;
+	for (i=cellNdxMin.x; i<=cellNdxMax.x; i++) {
+		for (j=cellNdxMin.y; j<=cellNdxMax.y; j++) {
+			m_zoneManager.setPassable(i, j, true);
+		}
+	}
+}
+
+void Pathfinder::getHierarchicalPathCacheStats(UnsignedInt *hits, UnsignedInt *misses, UnsignedInt *cellsSaved) const
+{
+	*hits = m_hierarchicalPathCacheHits;
+	*misses = m_hierarchicalPathCacheMisses;
+	*cellsSaved = m_hierarchicalPathCacheCellsSaved;
+}
+
+void Pathfinder::getPathfindQueueStats(UnsignedInt *paths, UnsignedInt *cells, Real *timeMsec) const
+{
+	LARGE_INTEGER freq;
+	QueryPerformanceFrequency(&freq);
+	*paths = m_queueStatsPaths;
+	*cells = m_queueStatsCells;
+	*timeMsec = (Real)((double)m_queueStatsTime * 1000.0 / (double)freq.QuadPart);
+}
+
+#if !RETAIL_COMPATIBLE_CRC
+bool Pathfinder::HierarchicalPathCacheKey::operator<(const HierarchicalPathCacheKey &other) const
+{
+	if (startBlockX != other.startBlockX) return startBlockX < other.startBlockX;
+	if (startBlockY != other.startBlockY) return startBlockY < other.startBlockY;
+	if (goalBlockX != other.goalBlockX) return goalBlockX < other.goalBlockX;
+	if (goalBlockY != other.goalBlockY) return goalBlockY < other.goalBlockY;
+	if (startZone != other.startZone) return startZone < other.startZone;
+	if (goalZone != other.goalZone) return goalZone < other.goalZone;
+	if (surfaces != other.surfaces) return surfaces < other.surfaces;
+	if (crusher != other.crusher) return crusher < other.crusher;
+	return isHuman < other.isHuman;
+}
+
+/**
+ * Build the cache key of a hierarchical path. Only ground to ground paths within the map are cached.
+ */
+Bool Pathfinder::makeHierarchicalPathCacheKey( Bool isHuman, const LocomotorSet& locomotorSet, const Coord3D *from,
+	const Coord3D *to, HierarchicalPathCacheKey &key )
+{
+	if (!m_isMapReady) {
+		return false;
+	}
+	if (TheTerrainLogic->getLayerForDestination(from) != LAYER_GROUND ||
+		TheTerrainLogic->getLayerForDestination(to) != LAYER_GROUND) {
+		return false;
+	}
+
+	ICoord2D startCell, goalCell;
+	worldToCell(from, &startCell);
+	worldToCell(to, &goalCell);
+	if (startCell.x<m_extent.lo.x || startCell.x>m_extent.hi.x || startCell.y<m_extent.lo.y || startCell.y>m_extent.hi.y ||
+		goalCell.x<m_extent.lo.x || goalCell.x>m_extent.hi.x || goalCell.y<m_extent.lo.y || goalCell.y>m_extent.hi.y) {
+		return false;
+	}
+
+	key.surfaces = locomotorSet.getValidSurfaces();
+	key.crusher = false;
+	key.isHuman = isHuman;
+	key.startBlockX = startCell.x/PathfindZoneManager::ZONE_BLOCK_SIZE;
+	key.startBlockY = startCell.y/PathfindZoneManager::ZONE_BLOCK_SIZE;
+	key.goalBlockX = goalCell.x/PathfindZoneManager::ZONE_BLOCK_SIZE;
+	key.goalBlockY = goalCell.y/PathfindZoneManager::ZONE_BLOCK_SIZE;
+	key.startZone = m_zoneManager.getBlockZone(key.surfaces, key.crusher, startCell.x, startCell.y, m_map);
+	key.goalZone = m_zoneManager.getBlockZone(key.surfaces, key.crusher, goalCell.x, goalCell.y, m_map);
+	return true;
+}
+
+/**
+ * Mark the blocks of a cached hierarchical path passable. Returns false if there is no valid entry.
+ */
+Bool Pathfinder::applyCachedHierarchicalPath( const HierarchicalPathCacheKey &key, const Coord3D *from )
+{
+	if (m_hierarchicalPathCacheZonesVersion != m_zoneManager.getZonesVersion() ||
+		m_hierarchicalPathCacheExtent.lo.x != m_logicalExtent.lo.x || m_hierarchicalPathCacheExtent.lo.y != m_logicalExtent.lo.y ||
+		m_hierarchicalPathCacheExtent.hi.x != m_logicalExtent.hi.x || m_hierarchicalPathCacheExtent.hi.y != m_logicalExtent.hi.y) {
+		m_hierarchicalPathCache.clear();
+		m_hierarchicalPathCacheZonesVersion = m_zoneManager.getZonesVersion();
+		m_hierarchicalPathCacheExtent = m_logicalExtent;
+	}
+
+	HierarchicalPathCache::const_iterator it = m_hierarchicalPathCache.find(key);
+	if (it == m_hierarchicalPathCache.end()) {
+		++m_hierarchicalPathCacheMisses;
+		return false;
+	}
+
+	++m_hierarchicalPathCacheHits;
+	m_hierarchicalPathCacheCellsSaved += it->second.cellsExamined;
+	if (it->second.found) {
+		m_zoneManager.setPassableBlocks(it->second.passableBlocks);
+#if !(RTS_GENERALS && RETAIL_COMPATIBLE_PATHFINDING)
+		setPassableAroundStart(from);
+#endif
+	} else {
+		m_zoneManager.setAllPassable();
+	}
+	return true;
+}
+
+/**
+ * Remember the blocks that the hierarchical path search just marked passable.
+ */
+void Pathfinder::addHierarchicalPathCacheEntry( const HierarchicalPathCacheKey &key, Bool found, Int cellsExamined )
+{
+	enum { MAX_HIERARCHICAL_PATH_CACHE_ENTRIES = 4096 };
+	if (m_hierarchicalPathCache.size() >= MAX_HIERARCHICAL_PATH_CACHE_ENTRIES) {
+		m_hierarchicalPathCache.clear();
+	}
+
+	HierarchicalPathCacheEntry &entry = m_hierarchicalPathCache[key];
+	entry.found = found;
+	entry.cellsExamined = cellsExamined;
+	if (found) {
+		m_zoneManager.getPassableBlocks(entry.passableBlocks);
+	} else {
+		entry.passableBlocks.clear();
+	}
+}
+#endif
+
 struct MADStruct
 {
 	Pathfinder					*thePathfinder;
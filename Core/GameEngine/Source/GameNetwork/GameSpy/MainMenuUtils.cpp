@@ -725,6 +725,8 @@ DWORD WINAPI asyncGethostbynameThreadFunc( void * szName )
 	}
 
 	s_asyncDNSThreadDone = TRUE;
+
+	ThreadClass::Thread_Exiting();
 	return 0;
 }
 
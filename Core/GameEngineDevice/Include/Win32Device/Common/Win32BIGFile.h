@@ -28,6 +28,8 @@
 
 #pragma once
 
+#include <windows.h>
+
 #include "Common/ArchiveFile.h"
 #include "Common/AsciiString.h"
 #include "Common/List.h"
@@ -48,6 +50,12 @@ class Win32BIGFile : public ArchiveFile
 
 	protected:
 
-		AsciiString		m_name;		///< BIG file name
-		AsciiString		m_path;		///< BIG file path
+		HANDLE				getMapping();															///< Returns the read only mapping of the whole BIG file, or null if it cannot be mapped
+		void					closeMapping();
+
+		AsciiString		m_name;					///< BIG file name
+		AsciiString		m_path;					///< BIG file path
+		HANDLE				m_mappedFile;		///< BIG file handle used for the mapping
+		HANDLE				m_mapping;			///< read only mapping of the BIG file, created on first use
+		Bool					m_mappingFailed;	///< the BIG file could not be mapped, so files are copied into RAM instead
 };
@@ -0,0 +1,55 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+///// Win32MappedArchiveFile.h ///////////////////////////
+// Ronin, October 2026
+//////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <windows.h>
+
+#include "Common/RAMFile.h"
+
+// Ronin @performance 16/10/2026 Read only file inside a BIG file that reads straight from a mapped view
+// of the BIG file, instead of from a heap copy of its data. The view is unmapped when the file is closed.
+class Win32MappedArchiveFile : public RAMFile
+{
+	MEMORY_POOL_GLUE_WITH_USERLOOKUP_CREATE(Win32MappedArchiveFile, "Win32MappedArchiveFile")
+protected:
+
+	void					*m_view;											///< base address of the mapped view that holds m_data
+
+public:
+
+	Win32MappedArchiveFile();
+	//virtual ~Win32MappedArchiveFile();
+
+	/// map the given range of the BIG file mapping and read the file from it.
+	Bool					openFromMapping(HANDLE mapping, const AsciiString& filename, Int offset, Int size);
+
+	virtual void	close() override;
+	virtual Bool	open( File *file ) override { DEBUG_CRASH(("Win32MappedArchiveFile can only be opened from a mapping.")); return FALSE; }
+	virtual Bool	openFromArchive(File *archiveFile, const AsciiString& filename, Int offset, Int size) override { DEBUG_CRASH(("Win32MappedArchiveFile can only be opened from a mapping.")); return FALSE; }
+
+	virtual char*	readEntireAndClose() override;
+
+protected:
+
+	void					unmapView();
+};
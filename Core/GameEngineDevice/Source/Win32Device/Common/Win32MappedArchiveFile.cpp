@@ -0,0 +1,135 @@
+/*
+**	Command & Conquer Generals Zero Hour(tm)
+**	Copyright 2026 TheSuperHackers
+**
+**	This program is free software: you can redistribute it and/or modify
+**	it under the terms of the GNU General Public License as published by
+**	the Free Software Foundation, either version 3 of the License, or
+**	(at your option) any later version.
+**
+**	This program is distributed in the hope that it will be useful,
+**	but WITHOUT ANY WARRANTY; without even the implied warranty of
+**	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**	GNU General Public License for more details.
+**
+**	You should have received a copy of the GNU General Public License
+**	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+///// Win32MappedArchiveFile.cpp /////////////////////////
+// Ronin, October 2026
+//////////////////////////////////////////////////////////
+
+#include "Common/GameMemory.h"
+#include "Win32Device/Common/Win32MappedArchiveFile.h"
+
+//============================================================================
+// Win32MappedArchiveFile::Win32MappedArchiveFile
+//============================================================================
+
+Win32MappedArchiveFile::Win32MappedArchiveFile()
+	: m_view(nullptr)
+{
+
+}
+
+//============================================================================
+// Win32MappedArchiveFile::~Win32MappedArchiveFile
+//============================================================================
+
+Win32MappedArchiveFile::~Win32MappedArchiveFile()
+{
+	unmapView();
+}
+
+//============================================================================
+// Win32MappedArchiveFile::openFromMapping
+//============================================================================
+
+/**
+	The file is only opened if its view could be mapped, so on failure the caller
+	must delete it instead of closing it.
+*/
+Bool Win32MappedArchiveFile::openFromMapping(HANDLE mapping, const AsciiString& filename, Int offset, Int size)
+{
+	if (mapping == nullptr) {
+		return FALSE;
+	}
+
+	// views must start on an allocation granularity boundary
+	static DWORD s_allocationGranularity = 0;
+	if (s_allocationGranularity == 0) {
+		SYSTEM_INFO systemInfo;
+		GetSystemInfo(&systemInfo);
+		s_allocationGranularity = systemInfo.dwAllocationGranularity;
+	}
+
+	const DWORD viewOffset = (DWORD)offset - ((DWORD)offset % s_allocationGranularity);
+	const DWORD viewDelta = (DWORD)offset - viewOffset;
+
+	m_view = MapViewOfFile(mapping, FILE_MAP_READ, 0, viewOffset, viewDelta + size);
+	if (m_view == nullptr) {
+		return FALSE;
+	}
+
+	if (File::open(filename.str(), File::READ | File::BINARY) == FALSE) {
+		unmapView();
+		return FALSE;
+	}
+
+	// the view is read only, but RAMFile never writes to its data after opening
+	m_data = (Char *)m_view + viewDelta;
+	m_size = size;
+	m_pos = 0;
+	m_nameStr = filename;
+
+	return TRUE;
+}
+
+//============================================================================
+// Win32MappedArchiveFile::close
+//============================================================================
+
+void Win32MappedArchiveFile::close()
+{
+	unmapView();
+	File::close();
+}
+
+//============================================================================
+// Win32MappedArchiveFile::unmapView
+//============================================================================
+
+void Win32MappedArchiveFile::unmapView()
+{
+	if (m_view != nullptr) {
+		UnmapViewOfFile(m_view);
+		m_view = nullptr;
+	}
+
+	// the data belongs to the view, so RAMFile must not delete it
+	m_data = nullptr;
+}
+
+//============================================================================
+// Win32MappedArchiveFile::readEntireAndClose
+//============================================================================
+/**
+	The caller owns the returned buffer and frees it with delete[], so the
+	data has to be copied out of the view here.
+*/
+char* Win32MappedArchiveFile::readEntireAndClose()
+{
+	if (m_data == nullptr)
+	{
+		DEBUG_CRASH(("m_data is null in Win32MappedArchiveFile::readEntireAndClose -- should not happen!"));
+		return NEW char[1];	// just to avoid crashing...
+	}
+
+	char* buffer = MSGNEW("RAMFILE") char[m_size];
+	memcpy(buffer, m_data, m_size);
+
+	close();
+
+	return buffer;
+}
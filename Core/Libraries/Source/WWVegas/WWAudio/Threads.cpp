@@ -33,6 +33,7 @@
 #include "always.h"
 #include "Threads.h"
 #include "Utils.h"
+#include "thread.h"
 #include <process.h>
 
 
@@ -247,6 +248,7 @@ WWAudioThreadsClass::Delayed_Release_Thread_Proc (LPVOID /*param*/)
 	}
 
 	Flush_Delayed_Release_Objects ();
+	ThreadClass::Thread_Exiting ();
 }
 
 /*
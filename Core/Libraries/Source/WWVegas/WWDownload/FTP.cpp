@@ -39,6 +39,7 @@
 //#include "wlib/wstring.h"
 
 #include "DownloadDebug.h"
+#include "thread.h"
 
 // umm... what?? BGC 3/27/03
 //#ifndef RTS_DEBUG
@@ -254,6 +255,7 @@ DWORD WINAPI gethostbynameA( void * szName )
    /////DBGMSG("Hostname copy complete");
 
 	gThreadFlag = 1;
+	ThreadClass::Thread_Exiting();
 	return 0;
 }
 
@@ -30,6 +30,8 @@
 #include <windows.h>
 #endif
 
+ThreadClass::ExitCallbackType ThreadClass::ExitCallback = nullptr;
+
 ThreadClass::ThreadClass(const char *thread_name, ExceptionHandlerType exception_handler) : handle(0), running(false), thread_priority(0)
 {
 	if (thread_name) {
@@ -77,6 +79,8 @@ void __cdecl ThreadClass::Internal_Thread_Function(void* params)
 	tc->Thread_Function();
 #endif //_WIN32
 
+	Thread_Exiting();
+
 #ifdef _WIN32
 	Unregister_Thread_ID(tc->ThreadID, tc->ThreadName);
 #endif // _WIN32
@@ -42,6 +42,7 @@ class ThreadClass
 {
 public:
 	typedef int (*ExceptionHandlerType)(int exception_code, struct _EXCEPTION_POINTERS *e_info);
+	typedef void (*ExitCallbackType)();
 
 	ThreadClass(const char *name = nullptr, ExceptionHandlerType exception_handler = nullptr);
 	virtual ~ThreadClass();
@@ -73,6 +74,12 @@ public:
 	// Get info about a registered thread by it's index.
 	static int Get_Thread_By_Index(int index, char *name_ptr = nullptr);
 
+	// Set a function that every thread calls on itself after its Thread_Function returns.
+	static void Set_Exit_Callback(ExitCallbackType callback) { ExitCallback = callback; }
+
+	// Run the exit callback. Threads that are not started through ThreadClass call this before they exit.
+	static void Thread_Exiting() { if (ExitCallback != nullptr) ExitCallback(); }
+
 protected:
 
 	// User defined thread function. The thread function should check for "running" flag every now and then
@@ -91,6 +98,7 @@ protected:
 
 private:
 	static void __cdecl Internal_Thread_Function(void*);
+	static ExitCallbackType ExitCallback;
 	volatile unsigned long handle;
 	int thread_priority;
 };
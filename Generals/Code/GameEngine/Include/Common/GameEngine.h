@@ -74,6 +74,11 @@ public:
 	virtual void serviceWindowsOS() {};		///< service the native OS
 	virtual Bool isActive() {return m_isActive;}	///< returns whether app has OS focus.
 	virtual void setIsActive(Bool isActive) { m_isActive = isActive; };
+
+	// Ronin @performance 16/10/2026 The client and logic parts of the last update, in seconds. The smaller
+	// of the two is what running logic and client concurrently could save per frame.
+	Real getClientUpdateTimeLastFrame() const { return m_clientUpdateTime; }
+	Real getLogicUpdateTimeLastFrame() const { return m_logicUpdateTime; }		///< 0 if the last update ran no logic frame
 	virtual void checkAbnormalQuitting();	///< check if user is quitting at an unusual time - as in cheating!
 
 protected:
@@ -99,6 +104,8 @@ protected:
 	virtual AudioManager *createAudioManager(Bool dummy) = 0;				///< Factory for Audio Manager
 
 	Real m_logicTimeAccumulator; ///< Frame time accumulated towards submitting a new logic frame
+	Real m_clientUpdateTime; ///< Seconds spent in radar, audio, client, message stream and network during the last update
+	Real m_logicUpdateTime; ///< Seconds spent in the logic frame of the last update
 
 	Bool m_quitting; ///< true when we need to quit the game
 	Bool m_isActive; ///< app has OS focus.
@@ -164,6 +164,10 @@ public:
 	SaveCode loadGame( AvailableGameInfo gameInfo );							 ///< load a save file
 	SaveGameInfo *getSaveGameInfo() { return &m_gameInfo; }
 
+	// in memory snapshots of the game state, used for replay seeking
+	SaveCode saveGameToBuffer( std::vector<UnsignedByte> &buffer );					///< save the game state into a memory buffer
+	SaveCode loadGameFromBuffer( const std::vector<UnsignedByte> &buffer );	///< load a buffer from saveGameToBuffer, the engine must be reset before
+
 	// snapshot interaction
 	void addPostProcessSnapshot( Snapshot *snapshot );					///< add snapshot to post process load
 
@@ -352,9 +352,15 @@ public:
 
 	std::vector<AsciiString> m_simulateReplays; ///< If not empty, simulate this list of replays and exit.
 	Int m_simulateReplayJobs; ///< Maximum number of processes to use for simulation, or SIMULATE_REPLAYS_SEQUENTIAL for sequential simulation
+	Int m_simulateReplaysPerJob; ///< Number of replays each worker process simulates in sequence before it exits
+	Bool m_simulateReplayWorker; ///< True in a worker process started by -jobs, which reports a result line per replay to its parent
+	AsciiString m_simulateReplayReport; ///< If not empty, write a report of the simulated replays to this file, or to stdout if "-"
+	Int m_simulateReplaySeekFrame; ///< If not negative, benchmark seeking to this frame in the simulated replays
+	UnsignedInt m_replaySnapshotInterval; ///< Logic frames between replay snapshots used for seeking, or 0 for the default
 
 	Int m_maxParticleCount;						///< maximum number of particles that can exist
 	Int m_maxFieldParticleCount;			///< maximum number of field-type particles that can exist (roughly)
+	Int m_particleUpdateThreads;			///< worker threads that help updating large particle systems, 0 to update them all on the client thread
 	WeaponBonusSet* m_weaponBonusSet;
 	Real m_healthBonus[LEVEL_COUNT];			///< global bonuses to health for veterancy.
 	Real m_defaultStructureRubbleHeight;	///< for rubbled structures, compress height to this if none specified
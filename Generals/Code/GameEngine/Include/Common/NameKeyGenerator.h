@@ -35,6 +35,8 @@
 #include "Common/GameMemory.h"
 #include "Common/AsciiString.h"
 
+#include <vector>
+
 //-------------------------------------------------------------------------------------------------
 // Note that NameKeyType isn't a "real" enum, but an enum type used to enforce the
 // fact that NameKeys are really magic cookies, and aren't really interchangeable
@@ -69,6 +71,15 @@ public:
 inline Bucket::Bucket() : m_nextInSocket(nullptr), m_key(NAMEKEY_INVALID) { }
 inline Bucket::~Bucket() { }
 
+//-------------------------------------------------------------------------------------------------
+// Hash used to pick the socket for a name. This is constexpr so that literal names, such as the
+// ones in StaticNameKey, can be hashed at compile time. Must match calcHashForString.
+//-------------------------------------------------------------------------------------------------
+inline constexpr UnsignedInt calcNameKeyHash(const char* p, UnsignedInt result = 0)
+{
+	return *p ? calcNameKeyHash(p + 1, (result << 5) + result + (Byte)*p) : result;
+}
+
 //-------------------------------------------------------------------------------------------------
 // This class implements the conversion of an arbitrary string into a unique
 // integer "key". Calling the nameToKey() method with the same string is
@@ -97,10 +108,11 @@ public:
 	NameKeyType nameToKey(const char* name);
 	NameKeyType nameToLowercaseKey(const char *name);
 
+	/// Same as nameToKey, for a name whose calcNameKeyHash value is already known.
+	NameKeyType nameToKeyWithHash(const char* name, UnsignedInt nameHash);
+
 	// given a key, return the name. this is almost never needed,
-	// except for a few rare cases like object serialization. also
-	// note that it's not particularly fast; it does a dumb linear
-	// search for the key.
+	// except for a few rare cases like object serialization.
 	AsciiString keyToName(NameKeyType key);
 
 	// Get a string out of the INI. Store it into a NameKeyType
@@ -128,6 +140,7 @@ private:
 	void freeSockets();
 
 	Bucket*				m_sockets[SOCKET_COUNT];			///< Catalog of all Buckets already generated
+	std::vector<const Bucket*> m_keyToBucket;	///< Bucket of each key, indexed by key - 1
 	UnsignedInt		m_nextID;											///< Next available ID
 
 };
@@ -149,8 +162,9 @@ class StaticNameKey
 private:
 	mutable NameKeyType m_key;
 	const char* m_name;
+	UnsignedInt m_nameHash;
 public:
-	StaticNameKey(const char* p) : m_key(NAMEKEY_INVALID), m_name(p) {}
+	constexpr StaticNameKey(const char* p) : m_key(NAMEKEY_INVALID), m_name(p), m_nameHash(calcNameKeyHash(p)) {}
 	NameKeyType key() const;
 	// ugh, this is a little hokey, but lets us pretend that a StaticNameKey == NameKeyType
 	operator NameKeyType() const { return key(); }
@@ -75,17 +75,32 @@ protected:
 		UnsignedInt getLocalPlayer() const { return m_localPlayer; }
 		void setSawCRCMismatch() { m_sawCRCMismatch = TRUE; }
 		Bool sawCRCMismatch() const { return m_sawCRCMismatch; }
+		void setMismatchFrame(Int frame) { if (m_mismatchFrame < 0) m_mismatchFrame = frame; }
+		Int getMismatchFrame() const { return m_mismatchFrame; }
+		UnsignedInt getReadCount() const { return m_readCount; }
 
 	protected:
 		Bool m_sawCRCMismatch;
 		Bool m_skippedOne;
+		Int m_mismatchFrame;
 		UnsignedInt m_localPlayer;
+		UnsignedInt m_readCount;
 		std::list<UnsignedInt> m_data;
 	};
 
 public:
 	struct ReplayHeader;
 
+	// The position of a running playback, which can be restored after the engine was reset.
+	struct PlaybackState
+	{
+		AsciiString filename;
+		Int filePosition;
+		UnsignedInt nextFrame;
+		RecorderModeType mode;
+		CRCInfo crcInfo;
+	};
+
 	RecorderClass();																	///< Constructor.
 	virtual ~RecorderClass() override;													///< Destructor.
 
@@ -106,9 +121,12 @@ public:
 	void stopPlayback();															///< Stops playback.  Its fine to call this even if not playing back a file.
 	Bool simulateReplay(AsciiString filename);
 #if defined(RTS_DEBUG)
-	Bool analyzeReplay( AsciiString filename );
+	Bool analyzeReplay( AsciiString filename, UnsignedInt startFrame = 0 );
 #endif
 	Bool isPlaybackInProgress() const;
+	Bool seekPlaybackToFrame(UnsignedInt frame);				///< Skip the commands before the given frame. Analysis playback only.
+	Bool getPlaybackState(PlaybackState &state) const;				///< Get the position of the current playback between two logic frames.
+	Bool restorePlaybackState(const PlaybackState &state);		///< Reopen the replay and continue the playback at the given position.
 
 public:
 	void handleCRCMessage(UnsignedInt newCRC, Int playerIndex, Bool fromPlayback);
@@ -133,8 +151,20 @@ public:
 		Bool playerDiscons[MAX_SLOTS];
 		AsciiString gameOptions;
 		Int localPlayerIndex;
+		Int headerSize;															///< Size of the header in bytes. The game settings and the commands follow it.
 	};
 	Bool readReplayHeader( ReplayHeader& header );
+	Bool readReplayIndex( ReplayHeader& header );		///< Like readReplayHeader for listing replays, but served from the replay index. Creates the index if it is missing or outdated.
+	static void deleteReplayIndex( AsciiString filename );	///< Delete the index of a replay that is being deleted.
+
+	// A frame of the replay command stream and the file position of its first command.
+	struct ReplayFrameOffset
+	{
+		UnsignedInt frame;
+		Int filePosition;
+	};
+	typedef std::vector<ReplayFrameOffset> ReplayFrameOffsetVec;
+	Bool readReplayFrameOffsets( AsciiString filename, ReplayFrameOffsetVec& offsets ); ///< Get the frames of a replay from its index. Scans the replay once if the index has no frame table yet.
 
 	RecorderModeType getMode();												///< Returns the current operating mode.
 	Bool isPlaybackMode() const { return m_mode == RECORDERMODETYPE_PLAYBACK || m_mode == RECORDERMODETYPE_SIMULATION_PLAYBACK; }
@@ -142,6 +172,7 @@ public:
 
 	static AsciiString getReplayDir();								///< Returns the directory that holds the replay files.
 	static AsciiString getReplayArchiveDir();					///< Returns the directory that holds the archived replay files.
+	static AsciiString getReplayIndexDir();						///< Returns the directory that holds the replay index files.
 	static AsciiString getReplayExtention();					///< Returns the file extention for replay files.
 	static AsciiString getLastReplayFileName();				///< Returns the filename used for the default replay.
 
@@ -154,6 +185,8 @@ public:
 	void logPlayerDisconnect(UnicodeString player, Int slot);
 	void logCRCMismatch();
 	Bool sawCRCMismatch() const;
+	Int getCRCMismatchFrame() const { return m_crcInfo.getMismatchFrame(); } ///< First frame with a CRC mismatch during playback, or -1
+	UnsignedInt getCRCCheckCount() const { return m_crcInfo.getReadCount(); } ///< Number of recorded CRCs compared during playback
 	void cleanUpReplayFile();										///< after a crash, send replay/debug info to a central repository
 
 	void setArchiveEnabled(Bool enable) { m_archiveReplays = enable; } ///< Enable or disable replay archiving.
@@ -171,8 +204,14 @@ protected:
 	void readNextFrame();															///< Read the next frame number to execute a command on.
 	void appendNextCommand();													///< Read the next GameMessage and append it to TheCommandList.
 	void writeArgument(GameMessageArgumentDataType type, const GameMessageArgumentType arg);
+	void appendToWriteBuffer(const void *data, Int size);				///< Queue bytes for m_file, see writeBufferToFile.
+	void writeBufferToFile();														///< Write all queued bytes to m_file in one go.
 	void readArgument(GameMessageArgumentDataType type, GameMessage *msg);
 
+	Bool loadReplayIndex(ReplayHeader& header, ReplayFrameOffsetVec *offsets);					///< Read the index of header.filename if it matches the replay file.
+	void saveReplayIndex(const ReplayHeader& header, const ReplayFrameOffsetVec *offsets);	///< Write the index of header.filename, offsets may be null.
+	Bool scanReplayFrameOffsets(const ReplayHeader& header, ReplayFrameOffsetVec& offsets);	///< Collect the frames by walking the command stream without decoding it.
+
 	struct CullBadCommandsResult
 	{
 		CullBadCommandsResult() : hasClearGameDataMessage(false) {}
@@ -183,6 +222,9 @@ protected:
 
 	CRCInfo m_crcInfo;
 	File* m_file;
+	std::vector<UnsignedByte> m_writeBuffer;					///< Commands of the current frame that are not written to m_file yet.
+	Int m_writeBufferFilePosition;										///< File position of the first byte in m_writeBuffer.
+	ReplayFrameOffsetVec m_recordedFrameOffsets;			///< Frames of the replay that is being recorded, saved to its index when recording stops.
 	AsciiString m_fileName;
 	Int m_currentFilePosition;
 	RecorderModeType m_mode;
@@ -142,6 +142,12 @@ private:
 	// actually, it's not a real frame at all, it has phase info in the lower bits...
 	UnsignedInt m_nextCallFrameAndPhase;
 	Int m_indexInLogic;
+#if !RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER
+	// links of the timing wheel slot this module is scheduled in
+	UpdateModule* m_prevInSleepySlot;
+	UpdateModule* m_nextInSleepySlot;
+	Int m_sleepySlot;
+#endif
 
 protected:
 
@@ -222,11 +228,30 @@ public:
 		return getObject();
 	}
 
+#if !RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER
+	UpdateModule* friend_getPrevInSleepySlot() const { return m_prevInSleepySlot; }
+	UpdateModule* friend_getNextInSleepySlot() const { return m_nextInSleepySlot; }
+	Int friend_getSleepySlot() const { return m_sleepySlot; }
+	void friend_setSleepySlotLinks(Int slot, UpdateModule* prev, UpdateModule* next)
+	{
+		m_sleepySlot = slot;
+		m_prevInSleepySlot = prev;
+		m_nextInSleepySlot = next;
+	}
+	void friend_setPrevInSleepySlot(UpdateModule* prev) { m_prevInSleepySlot = prev; }
+	void friend_setNextInSleepySlot(UpdateModule* next) { m_nextInSleepySlot = next; }
+#endif
+
 };
 inline UpdateModule::UpdateModule( Thing *thing, const ModuleData* moduleData ) :
 	BehaviorModule( thing, moduleData ),
 	m_indexInLogic(-1),
 	m_nextCallFrameAndPhase(0)
+#if !RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER
+	, m_prevInSleepySlot(nullptr)
+	, m_nextInSleepySlot(nullptr)
+	, m_sleepySlot(-1)
+#endif
 {
 	// nothing
 }
@@ -585,6 +585,18 @@ public:
 
 };
 
+//-------------------------------------------------------------------------------------------------
+// Ronin @performance 16/10/2026 State that script conditions can depend on. ScriptEngine bumps a version
+// of each whenever it changes, so scripts whose conditions only read this state can reuse their last result.
+enum ScriptStateType CPP_11(: Int)
+{
+	SCRIPT_STATE_COUNTERS,					///< Counter and timer values
+	SCRIPT_STATE_FLAGS,							///< Flag values and UI interactions
+	SCRIPT_STATE_NAMED_UNITS,				///< Named object cache and the death state of named objects
+
+	SCRIPT_STATE_COUNT
+};
+
 //-------------------------------------------------------------------------------------------------
 // ******************************** class Script ***********************************************
 //-------------------------------------------------------------------------------------------------
@@ -624,6 +636,12 @@ protected:	// Note - If you add any member vars, you must take them into account
 	Real				m_conditionTime;		///< Amount of time (cum) to evaluate conditions.
 	Real				m_curTime;		///< Amount of time (cum) to evaluate conditions.
 	Int					m_conditionExecutedCount; ///< Number of times conditions evaluated.
+	Int					m_conditionSkippedCount; ///< Number of times the cached condition result was used instead.
+	Bool				m_conditionDependenciesTracked; ///< If true, the conditions only read the state in m_conditionDependencies.
+	UnsignedInt	m_conditionDependencies; ///< Mask of ScriptStateType bits read by the conditions.
+	Bool				m_hasCachedConditionResult;
+	Bool				m_cachedConditionResult;
+	UnsignedInt	m_cachedConditionVersions[SCRIPT_STATE_COUNT]; ///< State versions the cached result was evaluated at.
 
 public:
 	Script();
@@ -651,12 +669,18 @@ public:
 	void updateFrom(Script *pSrc); ///< Updates this from pSrc.  pSrc IS MODIFIED - it's guts are removed.  jba.
 	void setFrameToEvaluate(UnsignedInt frame) {m_frameToEvaluateAt=frame;}
 	void incrementConditionCount() {m_conditionExecutedCount++;}
+	void incrementConditionSkippedCount() {m_conditionSkippedCount++;}
+	void setConditionDependencies(Bool tracked, UnsignedInt dependencies);
+	Bool getCachedConditionResult(const UnsignedInt *stateVersions, Bool *result) const;
+	void setCachedConditionResult(const UnsignedInt *stateVersions, Bool result);
 	void addToConditionTime(Real time) {m_conditionTime += time;}
 	void setCurTime(Real time) {m_curTime	= time;}
 	void setDelayEvalSeconds(Int delay) {m_delayEvaluationSeconds = delay;}
 
 	UnsignedInt getFrameToEvaluate() {return m_frameToEvaluateAt;}
 	Int getConditionCount() {return m_conditionExecutedCount;}
+	Int getConditionSkippedCount() {return m_conditionSkippedCount;}
+	Bool areConditionDependenciesTracked() const {return m_conditionDependenciesTracked;}
 	Real getConditionTime() {return m_conditionTime;}
 	Real getCurTime() {return m_curTime;}
 	Int getDelayEvalSeconds() {return m_delayEvaluationSeconds;}
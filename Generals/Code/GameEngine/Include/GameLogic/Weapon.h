@@ -831,6 +831,9 @@ public:
 
 	static void parseWeaponTemplateDefinition(INI* ini);
 
+	void setAreaDamageStatsEnabled(Bool enable) { m_areaDamageStatsEnabled = enable; } ///< Only the replay simulation report needs the area damage stats, so they are off by default
+	void getAreaDamageStats(UnsignedInt *detonations, UnsignedInt *victims, Real *timeMsec) const; ///< dealDamageInternal calls, damaged objects and time spent in WeaponTemplate::dealDamageInternal since the last reset
+
 protected:
 
 	WeaponTemplate *findWeaponTemplatePrivate( NameKeyType key ) const;
@@ -844,6 +847,21 @@ protected:
 
 private:
 
+	/**
+		Counts and times one call of WeaponTemplate::dealDamageInternal. Damage can kill objects whose death
+		weapons detonate in turn, so nested calls are counted but only the outermost call is timed.
+	*/
+	class AreaDamageStatsScope
+	{
+	public:
+		AreaDamageStatsScope();
+		~AreaDamageStatsScope();
+		void addVictim();
+	private:
+		Int64 m_startTime;
+		Bool m_active;
+	};
+
 	/**
 		WeaponDelayedDamageInfo is a utility class used by the WeaponStore to keep track
 		of what damage will need to be dealt in the future. It is never used for Projectile
@@ -859,6 +877,12 @@ private:
 		ObjectID m_delaySourceID;										///< who dealt the damage (by ID since it might be dead due to delay)
 		ObjectID m_delayIntendedVictimID;						///< who the damage was intended for (or zero if no specific target)
 		WeaponBonus m_bonus;												///< the weapon bonus to use
+		UnsignedInt m_sequence;											///< order in which the damage was queued
+	};
+
+	struct DelayedDamageSequenceLess
+	{
+		bool operator()(const WeaponDelayedDamageInfo& a, const WeaponDelayedDamageInfo& b) const { return a.m_sequence < b.m_sequence; }
 	};
 
 	std::vector<WeaponTemplate*> m_weaponTemplateVector;
@@ -867,7 +891,19 @@ private:
 	typedef std::hash_map<NameKeyType, WeaponTemplate*, rts::hash<NameKeyType>, rts::equal_to<NameKeyType> > WeaponTemplateMap;
 	WeaponTemplateMap m_weaponTemplateHashMap;
 
-	std::list<WeaponDelayedDamageInfo> m_weaponDDI;
+	// Ronin @performance 16/10/2026 Delayed damage is bucketed by the frame it is due, so the update only
+	// touches the entries of the current frame instead of walking every pending entry each frame.
+	typedef std::vector<WeaponDelayedDamageInfo> WeaponDelayedDamageVec;
+	typedef std::map<UnsignedInt, WeaponDelayedDamageVec> WeaponDelayedDamageMap;
+	WeaponDelayedDamageMap m_weaponDDI;
+	WeaponDelayedDamageVec m_dueWeaponDDI;								///< entries being dealt this frame
+	UnsignedInt m_weaponDDISequence;
+
+	UnsignedInt m_areaDamageDetonations;
+	UnsignedInt m_areaDamageVictims;
+	Int64 m_areaDamageTime;															///< performance counter ticks
+	Int m_areaDamageDepth;
+	Bool m_areaDamageStatsEnabled;
 };
 
 // EXTERNALS //////////////////////////////////////////////////////////////////////////////////////
@@ -465,6 +465,62 @@ Int parseJobs(char *args[], int num)
 	return 1;
 }
 
+Int parseReplaysPerJob(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_simulateReplaysPerJob = atoi(args[1]);
+		if (TheGlobalData->m_simulateReplaysPerJob < 1)
+		{
+			printf("Invalid number of replays per job: %d\n", TheGlobalData->m_simulateReplaysPerJob);
+			exit(1);
+		}
+		return 2;
+	}
+	return 1;
+}
+
+Int parseReplayWorker(char *args[], int num)
+{
+	TheWritableGlobalData->m_simulateReplayWorker = TRUE;
+	return 1;
+}
+
+Int parseReplayReport(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_simulateReplayReport = args[1];
+		return 2;
+	}
+	return 1;
+}
+
+Int parseReplaySeek(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_simulateReplaySeekFrame = atoi(args[1]);
+		if (TheGlobalData->m_simulateReplaySeekFrame < 0)
+		{
+			printf("Invalid replay seek frame: %d\n", TheGlobalData->m_simulateReplaySeekFrame);
+			exit(1);
+		}
+		return 2;
+	}
+	return 1;
+}
+
+Int parseReplaySnapshotInterval(char *args[], int num)
+{
+	if (num > 1)
+	{
+		TheWritableGlobalData->m_replaySnapshotInterval = atoi(args[1]);
+		return 2;
+	}
+	return 1;
+}
+
 Int parseXRes(char *args[], int num)
 {
 	if (num > 1)
@@ -475,6 +531,20 @@ Int parseXRes(char *args[], int num)
 	return 1;
 }
 
+Int parseParticleThreads(char *args[], int num)
+{
+	if (num > 1)
+	{
+		// Leave one core to the client thread, which updates its own slice as well.
+		SYSTEM_INFO systemInfo;
+		GetSystemInfo(&systemInfo);
+		const Int maxThreads = (Int)systemInfo.dwNumberOfProcessors > 1 ? (Int)systemInfo.dwNumberOfProcessors - 1 : 0;
+		TheWritableGlobalData->m_particleUpdateThreads = clamp(0, atoi(args[1]), maxThreads);
+		return 2;
+	}
+	return 1;
+}
+
 Int parseYRes(char *args[], int num)
 {
 	if (num > 1)
@@ -1144,6 +1214,31 @@ static CommandLineParam paramsForStartup[] =
 	// (If you have 4 cores, call it with -jobs 4)
 	// If you do not call this, all replays will be simulated in sequence in the same process.
 	{ "-jobs", parseJobs },
+
+	// Ronin @performance 16/10/2026
+	// Simulate up to N replays in each worker process started by -jobs.
+	// Each worker then pays the startup cost of loading the game data only once for all of its replays.
+	// Results are still printed per replay and in order. Defaults to 1.
+	{ "-replaysPerJob", parseReplaysPerJob },
+
+	// Ronin @performance 16/10/2026
+	// Passed by -jobs to its worker processes. Not meant to be used by hand.
+	{ "-replayWorker", parseReplayWorker },
+
+	// Ronin @feature 16/10/2026
+	// Write a machine readable report of the simulated replays. Pass the report filename afterwards.
+	// The report is written as CSV if the filename ends with .csv and as JSON otherwise.
+	// Contains the result, CRC mismatch frame, logic frame times, peak object count and pathfind statistics per replay.
+	{ "-replayReport", parseReplayReport },
+
+	// Ronin @feature 16/10/2026
+	// Benchmark seeking in replays. Pass the logic frame to seek to afterwards. Use with -headless -replay.
+	// Each replay is simulated once while taking logic snapshots, then the seek to the frame is timed.
+	{ "-replaySeek", parseReplaySeek },
+
+	// Ronin @feature 16/10/2026
+	// Logic frames between the snapshots that are taken for replay seeking. Defaults to one minute of game time.
+	{ "-replaySnapshotInterval", parseReplaySnapshotInterval },
 };
 
 // These Params are parsed during Engine Init before INI data is loaded
@@ -1166,6 +1261,11 @@ static CommandLineParam paramsForEngineInit[] =
 	// TheSuperHackers @feature xezon 03/08/2025 Force full viewport for 'Control Bar Pro' Addons like GenTool did it.
 	{ "-forcefullviewport", parseFullViewport },
 
+	// Ronin @performance 16/10/2026
+	// Update the particles of large particle systems on N worker threads in addition to the client thread.
+	// Particles are client only, so this does not affect the game logic. Defaults to 0.
+	{ "-particleThreads", parseParticleThreads },
+
 #if defined(RTS_DEBUG)
 	{ "-noaudio", parseNoAudio },
 	{ "-map", parseMapName },
@@ -253,6 +253,8 @@ GameEngine::GameEngine()
 {
 	// initialize to non garbage values
 	m_logicTimeAccumulator = 0.0f;
+	m_clientUpdateTime = 0.0f;
+	m_logicUpdateTime = 0.0f;
 	m_quitting = FALSE;
 	m_isActive = FALSE;
 
@@ -720,6 +722,15 @@ Bool GameEngine::canUpdateRegularGameLogic(UnsignedInt logicTimeQueryFlags)
 	return false;
 }
 
+/// -----------------------------------------------------------------------------------------------
+static Real getUpdateSeconds(const LARGE_INTEGER &start, const LARGE_INTEGER &end)
+{
+	static LARGE_INTEGER freq = { 0 };
+	if (freq.QuadPart == 0)
+		QueryPerformanceFrequency(&freq);
+	return (Real)((double)(end.QuadPart - start.QuadPart) / (double)freq.QuadPart);
+}
+
 /// -----------------------------------------------------------------------------------------------
 DECLARE_PERF_TIMER(GameEngine_update)
 
@@ -730,6 +741,8 @@ void GameEngine::update()
 {
 	USE_PERF_TIMER(GameEngine_update)
 	{
+		LARGE_INTEGER clientStart, logicStart, logicEnd;
+		QueryPerformanceCounter(&clientStart);
 		{
 			// VERIFY CRC needs to be in this code block.  Please to not pull TheGameLogic->update() inside this block.
 			VERIFY_CRC
@@ -748,6 +761,10 @@ void GameEngine::update()
 			}
 		}
 
+		QueryPerformanceCounter(&logicStart);
+		m_clientUpdateTime = getUpdateSeconds(clientStart, logicStart);
+		m_logicUpdateTime = 0.0f;
+
 		const Bool canUpdate = canUpdateGameLogic(FramePacer::IgnoreFrozenTime | FramePacer::IgnoreHaltedGame);
 		const Bool canUpdateLogic = canUpdate && !TheFramePacer->isGameHalted() && !TheFramePacer->isTimeFrozen();
 		const Bool canUpdateScript = canUpdate && !TheFramePacer->isGameHalted();
@@ -756,6 +773,9 @@ void GameEngine::update()
 		{
 			TheGameClient->step();
 			TheGameLogic->UPDATE();
+
+			QueryPerformanceCounter(&logicEnd);
+			m_logicUpdateTime = getUpdateSeconds(logicStart, logicEnd);
 		}
 		else if (canUpdateScript)
 		{
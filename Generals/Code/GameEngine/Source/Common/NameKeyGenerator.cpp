@@ -85,6 +85,7 @@ void NameKeyGenerator::freeSockets()
 		}
 		m_sockets[i] = nullptr;
 	}
+	m_keyToBucket.clear();
 
 }
 
@@ -111,14 +112,10 @@ inline UnsignedInt calcHashForLowercaseString(const char* p)
 //-------------------------------------------------------------------------------------------------
 AsciiString NameKeyGenerator::keyToName(NameKeyType key)
 {
-	for (Int i = 0; i < SOCKET_COUNT; ++i)
-	{
-		for (Bucket *b = m_sockets[i]; b; b = b->m_nextInSocket)
-		{
-			if (key == b->m_key)
-				return b->m_nameString;
-		}
-	}
+	// keys are handed out in order starting at 1, so NAMEKEY_INVALID wraps to an out of range index.
+	const UnsignedInt index = (UnsignedInt)key - 1;
+	if (index < m_keyToBucket.size())
+		return m_keyToBucket[index]->m_nameString;
 	return AsciiString::TheEmptyString;
 }
 
@@ -195,6 +192,24 @@ NameKeyType NameKeyGenerator::nameToKey(const char* name)
 	return createNameKey(hash, name);
 }
 
+//-------------------------------------------------------------------------------------------------
+NameKeyType NameKeyGenerator::nameToKeyWithHash(const char* name, UnsignedInt nameHash)
+{
+	DEBUG_ASSERTCRASH(nameHash == calcHashForString(name), ("Wrong hash for name key '%s'", name));
+	const UnsignedInt hash = nameHash % SOCKET_COUNT;
+
+	// do we have it already?
+	const Bucket *b;
+	for (b = m_sockets[hash]; b; b = b->m_nextInSocket)
+	{
+		if (strcmp(name, b->m_nameString.str()) == 0)
+			return b->m_key;
+	}
+
+	// nope, guess not. let's allocate it.
+	return createNameKey(hash, name);
+}
+
 //-------------------------------------------------------------------------------------------------
 NameKeyType NameKeyGenerator::nameToLowercaseKey(const char *name)
 {
@@ -221,6 +236,9 @@ NameKeyType NameKeyGenerator::createNameKey(UnsignedInt hash, const AsciiString&
 	b->m_nextInSocket = m_sockets[hash];
 	m_sockets[hash] = b;
 
+	DEBUG_ASSERTCRASH(m_keyToBucket.size() + 1 == (size_t)b->m_key, ("NameKey %d is out of order", b->m_key));
+	m_keyToBucket.push_back(b);
+
 	NameKeyType result = b->m_key;
 
 #if defined(RTS_DEBUG)
@@ -263,7 +281,7 @@ NameKeyType StaticNameKey::key() const
 	{
 		DEBUG_ASSERTCRASH(TheNameKeyGenerator, ("no TheNameKeyGenerator yet"));
 		if (TheNameKeyGenerator)
-			m_key = TheNameKeyGenerator->nameToKey(m_name);
+			m_key = TheNameKeyGenerator->nameToKeyWithHash(m_name, m_nameHash);
 	}
 	return m_key;
 }
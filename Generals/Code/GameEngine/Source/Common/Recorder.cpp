@@ -51,6 +51,12 @@
 constexpr const char s_genrep[] = "GENREP";
 constexpr const UnsignedInt replayBufferBytes = 8192;
 
+// Ronin @performance 16/10/2026 Replay index files live next to the replays and hold the header summary
+// and the frame table of one replay, so the replay menu and tools do not need to parse the replay itself.
+constexpr const char s_genidx[] = "GENIDX";
+constexpr const UnsignedInt replayIndexVersion = 3;
+const char *replayIndexExtention = ".idx";
+
 Int REPLAY_CRC_INTERVAL = 100;
 
 const char *replayExtention = ".rep";
@@ -103,14 +109,18 @@ static FILE* openStatsLogFile()
 RecorderClass::CRCInfo::CRCInfo() :
 	m_sawCRCMismatch(FALSE),
 	m_skippedOne(FALSE),
-	m_localPlayer(0)
+	m_mismatchFrame(-1),
+	m_localPlayer(0),
+	m_readCount(0)
 {}
 
 RecorderClass::CRCInfo::CRCInfo(UnsignedInt localPlayer, Bool isMultiplayer)
 {
 	m_sawCRCMismatch = FALSE;
 	m_skippedOne = !isMultiplayer;
+	m_mismatchFrame = -1;
 	m_localPlayer = localPlayer;
+	m_readCount = 0;
 }
 
 void RecorderClass::CRCInfo::addCRC(UnsignedInt val)
@@ -140,6 +150,7 @@ UnsignedInt RecorderClass::CRCInfo::readCRC()
 
 	UnsignedInt val = m_data.front();
 	m_data.pop_front();
+	++m_readCount;
 	//DEBUG_LOG(("CRCInfo::readCRC() - returning %8.8X, full=%d, size=%d", val, !m_data.empty(), m_data.size()));
 	return val;
 }
@@ -368,6 +379,7 @@ void RecorderClass::init() {
 	m_file = nullptr;
 	m_fileName.clear();
 	m_currentFilePosition = 0;
+	m_writeBufferFilePosition = 0;
 	m_gameInfo.clearSlotList();
 	m_gameInfo.reset();
 	if (TheGlobalData->m_pendingFile.isEmpty())
@@ -388,9 +400,12 @@ void RecorderClass::init() {
  */
 void RecorderClass::reset() {
 	if (m_file != nullptr) {
+		writeBufferToFile();
 		m_file->close();
 		m_file = nullptr;
 	}
+	m_writeBuffer.clear();
+	m_recordedFrameOffsets.clear();
 	m_fileName.clear();
 
 	init();
@@ -506,6 +521,7 @@ void RecorderClass::updateRecord()
 
 	if (needFlush) {
 		DEBUG_ASSERTCRASH(m_file != nullptr, ("RecorderClass::updateRecord() - unexpected call to fflush(m_file)"));
+		writeBufferToFile();
 		m_file->flush();
 	}
 }
@@ -674,6 +690,8 @@ void RecorderClass::startRecording(GameDifficulty diff, Int originalGameMode, In
 
 	DEBUG_LOG(("RecorderClass::startRecording() - diff=%d, mode=%d, FPS=%d", diff, originalGameMode, maxFPS));
 
+	m_writeBufferFilePosition = m_file->position();
+
 	/*
 	// Write the map name.
 	fprintf(m_file, "%s", (TheGlobalData->m_mapName).str());
@@ -688,6 +706,7 @@ void RecorderClass::startRecording(GameDifficulty diff, Int originalGameMode, In
  * every game.
  */
 void RecorderClass::stopRecording() {
+	writeBufferToFile();
 	logGameEnd();
 	if (TheNetwork)
 	{
@@ -702,9 +721,17 @@ void RecorderClass::stopRecording() {
 		m_file->close();
 		m_file = nullptr;
 
+		// Index the finished replay while its frame table is at hand.
+		ReplayHeader header;
+		header.forPlayback = FALSE;
+		header.filename = m_fileName;
+		if (readReplayHeader(header))
+			saveReplayIndex(header, &m_recordedFrameOffsets);
+
 		if (m_archiveReplays)
 			archiveReplay(m_fileName);
 	}
+	m_recordedFrameOffsets.clear();
 	m_fileName.clear();
 }
 
@@ -743,15 +770,21 @@ void RecorderClass::archiveReplay(AsciiString fileName)
 void RecorderClass::writeToFile(GameMessage * msg) {
 	// Write the frame number for this command.
 	UnsignedInt frame = TheGameLogic->getFrame();
-	m_file->write(&frame, sizeof(frame));
+	if (m_recordedFrameOffsets.empty() || m_recordedFrameOffsets.back().frame != frame) {
+		ReplayFrameOffset offset;
+		offset.frame = frame;
+		offset.filePosition = m_writeBufferFilePosition + (Int)m_writeBuffer.size();
+		m_recordedFrameOffsets.push_back(offset);
+	}
+	appendToWriteBuffer(&frame, sizeof(frame));
 
 	// Write the command type
 	GameMessage::Type type = msg->getType();
-	m_file->write(&type, sizeof(type));
+	appendToWriteBuffer(&type, sizeof(type));
 
 	// Write the player index
 	Int playerIndex = msg->getPlayerIndex();
-	m_file->write(&playerIndex, sizeof(playerIndex));
+	appendToWriteBuffer(&playerIndex, sizeof(playerIndex));
 
 #ifdef DEBUG_LOGGING
 	AsciiString commandName = msg->getCommandAsString();
@@ -770,20 +803,29 @@ void RecorderClass::writeToFile(GameMessage * msg) {
 		//commandName.str(), msg->getPlayerIndex(), TheGameLogic->getFrame()));
 #endif // DEBUG_LOGGING
 
-	GameMessageParser *parser = newInstance(GameMessageParser)(msg);
-	UnsignedByte numTypes = parser->getNumTypes();
-	m_file->write(&numTypes, sizeof(numTypes));
+	// Write the runs of equal argument types. This is the layout GameMessageParser produces, including
+	// its byte sized argument count, but without allocating a parser for every message.
+	const size_t numTypesPos = m_writeBuffer.size();
+	UnsignedByte numTypes = 0;
+	appendToWriteBuffer(&numTypes, sizeof(numTypes));
+
+	const Int numTypedArgs = (UnsignedByte)msg->getArgumentCount();
+	for (Int runStart = 0; runStart < numTypedArgs; ) {
+		const GameMessageArgumentDataType runType = msg->getArgumentDataType(runStart);
+		Int runEnd = runStart + 1;
+		while (runEnd < numTypedArgs && msg->getArgumentDataType(runEnd) == runType)
+			++runEnd;
 
-	GameMessageParserArgumentType *argType = parser->getFirstArgumentType();
-	while (argType != nullptr) {
-		UnsignedByte type = (UnsignedByte)(argType->getType());
-		m_file->write(&type, sizeof(type));
+		UnsignedByte type = (UnsignedByte)runType;
+		appendToWriteBuffer(&type, sizeof(type));
 
-		UnsignedByte argTypeCount = (UnsignedByte)(argType->getArgCount());
-		m_file->write(&argTypeCount, sizeof(argTypeCount));
+		UnsignedByte argTypeCount = (UnsignedByte)(runEnd - runStart);
+		appendToWriteBuffer(&argTypeCount, sizeof(argTypeCount));
 
-		argType = argType->getNext();
+		++numTypes;
+		runStart = runEnd;
 	}
+	m_writeBuffer[numTypesPos] = numTypes;
 
 //	UnsignedByte lasttype = (UnsignedByte)ARGUMENTDATATYPE_UNKNOWN;
 	Int numArgs = msg->getArgumentCount();
@@ -796,9 +838,25 @@ void RecorderClass::writeToFile(GameMessage * msg) {
 		writeArgument(msg->getArgumentDataType(i), *(msg->getArgument(i)));
 	}
 
-	deleteInstance(parser);
-	parser = nullptr;
+}
+
+/**
+ * Queue bytes for m_file. The commands of a frame are collected here and written with a single call
+ * when updateRecord flushes the file, instead of one small write per field.
+ */
+void RecorderClass::appendToWriteBuffer(const void *data, Int size) {
+	const UnsignedByte *bytes = static_cast<const UnsignedByte *>(data);
+	m_writeBuffer.insert(m_writeBuffer.end(), bytes, bytes + size);
+}
+
+void RecorderClass::writeBufferToFile() {
+	if (m_writeBuffer.empty())
+		return;
 
+	if (m_file != nullptr)
+		m_file->write(&m_writeBuffer[0], (Int)m_writeBuffer.size());
+	m_writeBufferFilePosition += (Int)m_writeBuffer.size();
+	m_writeBuffer.clear();
 }
 
 void RecorderClass::writeArgument(GameMessageArgumentDataType type, const GameMessageArgumentType arg) {
@@ -806,37 +864,37 @@ void RecorderClass::writeArgument(GameMessageArgumentDataType type, const GameMe
 	switch (type) {
 
 		case ARGUMENTDATATYPE_INTEGER:
-			m_file->write( &(arg.integer), sizeof(arg.integer) );
+			appendToWriteBuffer(&(arg.integer), sizeof(arg.integer));
 			break;
 		case ARGUMENTDATATYPE_REAL:
-			m_file->write( &(arg.real), sizeof(arg.real) );
+			appendToWriteBuffer(&(arg.real), sizeof(arg.real));
 			break;
 		case ARGUMENTDATATYPE_BOOLEAN:
-			m_file->write( &(arg.boolean), sizeof(arg.boolean) );
+			appendToWriteBuffer(&(arg.boolean), sizeof(arg.boolean));
 			break;
 		case ARGUMENTDATATYPE_OBJECTID:
-			m_file->write( &(arg.objectID), sizeof(arg.objectID) );
+			appendToWriteBuffer(&(arg.objectID), sizeof(arg.objectID));
 			break;
 		case ARGUMENTDATATYPE_DRAWABLEID:
-			m_file->write( &(arg.drawableID), sizeof(arg.drawableID) );
+			appendToWriteBuffer(&(arg.drawableID), sizeof(arg.drawableID));
 			break;
 		case ARGUMENTDATATYPE_TEAMID:
-			m_file->write( &(arg.teamID), sizeof(arg.teamID) );
+			appendToWriteBuffer(&(arg.teamID), sizeof(arg.teamID));
 			break;
 		case ARGUMENTDATATYPE_LOCATION:
-			m_file->write( &(arg.location), sizeof(arg.location) );
+			appendToWriteBuffer(&(arg.location), sizeof(arg.location));
 			break;
 		case ARGUMENTDATATYPE_PIXEL:
-			m_file->write( &(arg.pixel), sizeof(arg.pixel) );
+			appendToWriteBuffer(&(arg.pixel), sizeof(arg.pixel));
 			break;
 		case ARGUMENTDATATYPE_PIXELREGION:
-			m_file->write( &(arg.pixelRegion), sizeof(arg.pixelRegion) );
+			appendToWriteBuffer(&(arg.pixelRegion), sizeof(arg.pixelRegion));
 			break;
 		case ARGUMENTDATATYPE_TIMESTAMP:
-			m_file->write( &(arg.timestamp), sizeof(arg.timestamp) );
+			appendToWriteBuffer(&(arg.timestamp), sizeof(arg.timestamp));
 			break;
 		case ARGUMENTDATATYPE_WIDECHAR:
-			m_file->write( &(arg.wChar), sizeof(arg.wChar) );
+			appendToWriteBuffer(&(arg.wChar), sizeof(arg.wChar));
 			break;
 		default:
 			DEBUG_LOG(("Unknown GameMessageArgumentDataType in RecorderClass::writeArgument"));
@@ -904,44 +962,378 @@ Bool RecorderClass::readReplayHeader(ReplayHeader& header)
 
 	// Read in the GameInfo
 	header.gameOptions = readAsciiString();
-	m_gameInfo.reset();
-	m_gameInfo.enterGame();
-	DEBUG_LOG(("RecorderClass::readReplayHeader - GameInfo = %s", header.gameOptions.str()));
-	if (!ParseAsciiStringToGameInfo(&m_gameInfo, header.gameOptions))
+
+	AsciiString playerIndex = readAsciiString();
+	header.localPlayerIndex = atoi(playerIndex.str());
+	if (header.localPlayerIndex < -1 || header.localPlayerIndex >= MAX_SLOTS)
 	{
-		DEBUG_LOG(("RecorderClass::readReplayHeader - replay file did not have a valid GameInfo string."));
+		DEBUG_LOG(("RecorderClass::readReplayHeader - invalid local slot number."));
 		m_file->close();
 		m_file = nullptr;
 		return FALSE;
 	}
-	m_gameInfo.startGame(0);
 
-	AsciiString playerIndex = readAsciiString();
-	header.localPlayerIndex = atoi(playerIndex.str());
-	if (header.localPlayerIndex < -1 || header.localPlayerIndex >= MAX_SLOTS)
+	header.headerSize = m_file->position();
+
+	// Ronin @performance 16/10/2026 Only set up the GameInfo for playback. Callers that list replays
+	// parse header.gameOptions themselves, so parsing it here as well was wasted work for every file.
+	if (!header.forPlayback)
 	{
-		DEBUG_LOG(("RecorderClass::readReplayHeader - invalid local slot number."));
-		m_gameInfo.endGame();
+		m_file->close();
+		m_file = nullptr;
+		return TRUE;
+	}
+
+	m_gameInfo.reset();
+	m_gameInfo.enterGame();
+	DEBUG_LOG(("RecorderClass::readReplayHeader - GameInfo = %s", header.gameOptions.str()));
+	if (!ParseAsciiStringToGameInfo(&m_gameInfo, header.gameOptions))
+	{
+		DEBUG_LOG(("RecorderClass::readReplayHeader - replay file did not have a valid GameInfo string."));
 		m_gameInfo.reset();
 		m_file->close();
 		m_file = nullptr;
 		return FALSE;
 	}
+	m_gameInfo.startGame(0);
+
 	if (header.localPlayerIndex >= 0)
 	{
 		Int localIP = m_gameInfo.getSlot(header.localPlayerIndex)->getIP();
 		m_gameInfo.setLocalIP(localIP);
 	}
 
-	if (!header.forPlayback)
+	return TRUE;
+}
+
+/**
+ * Read a replay header for listing replays. The header is taken from the replay index if the index is
+ * up to date with the replay file. Otherwise the header is read from the replay and the index is written,
+ * so old replays get indexed the first time they are listed.
+ */
+Bool RecorderClass::readReplayIndex(ReplayHeader& header)
+{
+	header.forPlayback = FALSE;
+	if (loadReplayIndex(header, nullptr))
+		return TRUE;
+
+	if (!readReplayHeader(header))
+		return FALSE;
+
+	saveReplayIndex(header, nullptr);
+	return TRUE;
+}
+
+/**
+ * Get the frame table of a replay, which maps each frame with commands to the file position of its first
+ * command. Indexes written while recording already contain it. For older replays the command stream is
+ * walked once and the index is updated.
+ */
+Bool RecorderClass::readReplayFrameOffsets(AsciiString filename, ReplayFrameOffsetVec& offsets)
+{
+	ReplayHeader header;
+	header.forPlayback = FALSE;
+	header.filename = filename;
+	if (loadReplayIndex(header, &offsets))
+		return TRUE;
+
+	if (!readReplayHeader(header))
+		return FALSE;
+
+	if (!scanReplayFrameOffsets(header, offsets))
+		return FALSE;
+
+	saveReplayIndex(header, &offsets);
+	return TRUE;
+}
+
+static void writeIndexString(File *file, const AsciiString& str)
+{
+	Int length = str.getLength();
+	file->write(&length, sizeof(length));
+	file->write(str.str(), length * sizeof(char));
+}
+
+static void writeIndexString(File *file, const UnicodeString& str)
+{
+	Int length = str.getLength();
+	file->write(&length, sizeof(length));
+	file->write(str.str(), length * sizeof(WideChar));
+}
+
+static Bool readIndexString(File *file, AsciiString& str)
+{
+	Int length = 0;
+	if (file->read(&length, sizeof(length)) != sizeof(length) || length < 0 || length > file->size())
+		return FALSE;
+
+	str.clear();
+	if (length == 0)
+		return TRUE;
+
+	char *buf = str.getBufferForRead(length);
+	if (file->read(buf, length * sizeof(char)) != length * (Int)sizeof(char))
+		return FALSE;
+	buf[length] = '\0';
+	return TRUE;
+}
+
+static Bool readIndexString(File *file, UnicodeString& str)
+{
+	Int length = 0;
+	if (file->read(&length, sizeof(length)) != sizeof(length) || length < 0 || length > file->size())
+		return FALSE;
+
+	str.clear();
+	if (length == 0)
+		return TRUE;
+
+	WideChar *buf = str.getBufferForRead(length);
+	if (file->read(buf, length * sizeof(WideChar)) != length * (Int)sizeof(WideChar))
+		return FALSE;
+	buf[length] = L'\0';
+	return TRUE;
+}
+
+static AsciiString getReplayIndexPath(const AsciiString& replayFilename)
+{
+	AsciiString path = RecorderClass::getReplayIndexDir();
+	path.concat(replayFilename);
+	path.concat(replayIndexExtention);
+	return path;
+}
+
+/**
+ * Delete the index of a replay. The index of a missing replay is never used, this just keeps the
+ * index directory from filling up with indexes of deleted replays.
+ */
+void RecorderClass::deleteReplayIndex(AsciiString filename)
+{
+	DeleteFile(getReplayIndexPath(filename).str());
+}
+
+/**
+ * Read the index of header.filename. The index is only used if the replay exists and its size and
+ * time stamp still match the ones stored in the index. If offsets is not null, the index must also
+ * have a frame table.
+ */
+Bool RecorderClass::loadReplayIndex(ReplayHeader& header, ReplayFrameOffsetVec *offsets)
+{
+	AsciiString replayPath = getReplayDir();
+	replayPath.concat(header.filename);
+
+	FileInfo replayInfo;
+	if (!TheFileSystem->getFileInfo(replayPath, &replayInfo))
+		return FALSE;
+
+	File *file = TheFileSystem->openFile(getReplayIndexPath(header.filename).str(), File::READ | File::BINARY);
+	if (file == nullptr)
+		return FALSE;
+
+	Bool valid = TRUE;
+
+	char genidx[sizeof(s_genidx) - 1] = {0};
+	UnsignedInt version = 0;
+	Int64 replaySize = 0;
+	Int64 replayTimestamp = 0;
+	file->read(&genidx, sizeof(genidx));
+	file->read(&version, sizeof(version));
+	file->read(&replaySize, sizeof(replaySize));
+	file->read(&replayTimestamp, sizeof(replayTimestamp));
+	if (strncmp(genidx, s_genidx, sizeof(genidx)) != 0 || version != replayIndexVersion
+		|| replaySize != replayInfo.size() || replayTimestamp != replayInfo.timestamp())
 	{
-		m_gameInfo.endGame();
-		m_gameInfo.reset();
-		m_file->close();
-		m_file = nullptr;
+		valid = FALSE;
 	}
 
-	return TRUE;
+	if (valid)
+	{
+		replay_time_t tmp;
+		file->read(&tmp, sizeof(tmp));
+		header.startTime = tmp;
+		file->read(&tmp, sizeof(tmp));
+		header.endTime = tmp;
+		file->read(&header.frameCount, sizeof(header.frameCount));
+		file->read(&header.desyncGame, sizeof(header.desyncGame));
+		file->read(&header.quitEarly, sizeof(header.quitEarly));
+		file->read(header.playerDiscons, sizeof(header.playerDiscons));
+		file->read(&header.timeVal, sizeof(header.timeVal));
+		file->read(&header.versionNumber, sizeof(header.versionNumber));
+		file->read(&header.exeCRC, sizeof(header.exeCRC));
+		file->read(&header.iniCRC, sizeof(header.iniCRC));
+		file->read(&header.localPlayerIndex, sizeof(header.localPlayerIndex));
+		file->read(&header.headerSize, sizeof(header.headerSize));
+		valid = readIndexString(file, header.replayName)
+			&& readIndexString(file, header.versionString)
+			&& readIndexString(file, header.versionTimeString)
+			&& readIndexString(file, header.gameOptions);
+	}
+
+	if (valid && offsets != nullptr)
+	{
+		// A negative count means that the frame table was not built yet.
+		Int count = -1;
+		file->read(&count, sizeof(count));
+		if (count < 0)
+		{
+			valid = FALSE;
+		}
+		else
+		{
+			offsets->resize(count);
+			if (count > 0)
+				valid = file->read(&(*offsets)[0], count * sizeof(ReplayFrameOffset)) == count * (Int)sizeof(ReplayFrameOffset);
+		}
+	}
+
+	file->close();
+	return valid;
+}
+
+/**
+ * Write the index of header.filename. Failing to write it is not an error, the replay is indexed again
+ * the next time it is read.
+ */
+void RecorderClass::saveReplayIndex(const ReplayHeader& header, const ReplayFrameOffsetVec *offsets)
+{
+	AsciiString replayPath = getReplayDir();
+	replayPath.concat(header.filename);
+
+	FileInfo replayInfo;
+	if (!TheFileSystem->getFileInfo(replayPath, &replayInfo))
+		return;
+
+	TheFileSystem->createDirectory(getReplayIndexDir());
+	File *file = TheFileSystem->openFile(getReplayIndexPath(header.filename).str(), File::WRITE | File::BINARY);
+	if (file == nullptr)
+	{
+		DEBUG_LOG(("RecorderClass::saveReplayIndex - can't write the index of %s", header.filename.str()));
+		return;
+	}
+
+	const Int64 replaySize = replayInfo.size();
+	const Int64 replayTimestamp = replayInfo.timestamp();
+	file->write(s_genidx, sizeof(s_genidx) - 1);
+	file->write(&replayIndexVersion, sizeof(replayIndexVersion));
+	file->write(&replaySize, sizeof(replaySize));
+	file->write(&replayTimestamp, sizeof(replayTimestamp));
+
+	replay_time_t tmp = (replay_time_t)header.startTime;
+	file->write(&tmp, sizeof(tmp));
+	tmp = (replay_time_t)header.endTime;
+	file->write(&tmp, sizeof(tmp));
+	file->write(&header.frameCount, sizeof(header.frameCount));
+	file->write(&header.desyncGame, sizeof(header.desyncGame));
+	file->write(&header.quitEarly, sizeof(header.quitEarly));
+	file->write(header.playerDiscons, sizeof(header.playerDiscons));
+	file->write(&header.timeVal, sizeof(header.timeVal));
+	file->write(&header.versionNumber, sizeof(header.versionNumber));
+	file->write(&header.exeCRC, sizeof(header.exeCRC));
+	file->write(&header.iniCRC, sizeof(header.iniCRC));
+	file->write(&header.localPlayerIndex, sizeof(header.localPlayerIndex));
+	file->write(&header.headerSize, sizeof(header.headerSize));
+	writeIndexString(file, header.replayName);
+	writeIndexString(file, header.versionString);
+	writeIndexString(file, header.versionTimeString);
+	writeIndexString(file, header.gameOptions);
+
+	Int count = offsets ? (Int)offsets->size() : -1;
+	file->write(&count, sizeof(count));
+	if (count > 0)
+		file->write(&(*offsets)[0], count * sizeof(ReplayFrameOffset));
+
+	file->close();
+}
+
+static Int getReplayArgumentSize(GameMessageArgumentDataType type)
+{
+	const GameMessageArgumentType arg = {};
+	switch (type)
+	{
+		case ARGUMENTDATATYPE_INTEGER:			return sizeof(arg.integer);
+		case ARGUMENTDATATYPE_REAL:					return sizeof(arg.real);
+		case ARGUMENTDATATYPE_BOOLEAN:			return sizeof(arg.boolean);
+		case ARGUMENTDATATYPE_OBJECTID:			return sizeof(arg.objectID);
+		case ARGUMENTDATATYPE_DRAWABLEID:		return sizeof(arg.drawableID);
+		case ARGUMENTDATATYPE_TEAMID:				return sizeof(arg.teamID);
+		case ARGUMENTDATATYPE_LOCATION:			return sizeof(arg.location);
+		case ARGUMENTDATATYPE_PIXEL:				return sizeof(arg.pixel);
+		case ARGUMENTDATATYPE_PIXELREGION:	return sizeof(arg.pixelRegion);
+		case ARGUMENTDATATYPE_TIMESTAMP:		return sizeof(arg.timestamp);
+		case ARGUMENTDATATYPE_WIDECHAR:			return sizeof(arg.wChar);
+		default:														return -1;
+	}
+}
+
+/**
+ * Walk the command stream of a replay and note where each frame starts. The arguments are skipped
+ * by their size, so this is much cheaper than decoding the commands with appendNextCommand.
+ */
+Bool RecorderClass::scanReplayFrameOffsets(const ReplayHeader& header, ReplayFrameOffsetVec& offsets)
+{
+	AsciiString replayPath = getReplayDir();
+	replayPath.concat(header.filename);
+
+	File *file = TheFileSystem->openFile(replayPath.str(), File::READ | File::BINARY, replayBufferBytes);
+	if (file == nullptr)
+		return FALSE;
+
+	// Skip difficulty, original game mode, rank points and max fps.
+	const Int commandsStart = header.headerSize + 4 * (Int)sizeof(Int);
+	Bool valid = file->seek(commandsStart, File::START) == commandsStart;
+
+	offsets.clear();
+	while (valid)
+	{
+		const Int position = file->position();
+
+		UnsignedInt frame;
+		if (file->read(&frame, sizeof(frame)) != sizeof(frame))
+			break; // end of the replay
+
+		if (offsets.empty() || offsets.back().frame != frame)
+		{
+			ReplayFrameOffset offset;
+			offset.frame = frame;
+			offset.filePosition = position;
+			offsets.push_back(offset);
+		}
+
+		GameMessage::Type type;
+		Int playerIndex;
+		UnsignedByte numTypes = 0;
+		file->read(&type, sizeof(type));
+		file->read(&playerIndex, sizeof(playerIndex));
+		if (file->read(&numTypes, sizeof(numTypes)) != sizeof(numTypes))
+		{
+			valid = FALSE;
+			break;
+		}
+
+		Int argumentBytes = 0;
+		for (UnsignedByte i = 0; i < numTypes; ++i)
+		{
+			UnsignedByte argType = (UnsignedByte)ARGUMENTDATATYPE_UNKNOWN;
+			UnsignedByte argCount = 0;
+			file->read(&argType, sizeof(argType));
+			file->read(&argCount, sizeof(argCount));
+
+			const Int argSize = getReplayArgumentSize((GameMessageArgumentDataType)argType);
+			if (argSize < 0)
+			{
+				DEBUG_LOG(("RecorderClass::scanReplayFrameOffsets - unknown argument type %d in %s", argType, header.filename.str()));
+				valid = FALSE;
+				break;
+			}
+			argumentBytes += argSize * argCount;
+		}
+
+		if (valid && argumentBytes > 0)
+			file->seek(argumentBytes, File::CURRENT);
+	}
+
+	file->close();
+	return valid;
 }
 
 Bool RecorderClass::simulateReplay(AsciiString filename)
@@ -953,10 +1345,15 @@ Bool RecorderClass::simulateReplay(AsciiString filename)
 }
 
 #if defined(RTS_DEBUG)
-Bool RecorderClass::analyzeReplay( AsciiString filename )
+Bool RecorderClass::analyzeReplay( AsciiString filename, UnsignedInt startFrame )
 {
 	m_doingAnalysis = TRUE;
-	return playbackFile(filename);
+	if (!playbackFile(filename))
+		return FALSE;
+
+	if (startFrame > 0 && !seekPlaybackToFrame(startFrame))
+		DEBUG_LOG(("RecorderClass::analyzeReplay - cannot seek to frame %u, analyzing from the start", startFrame));
+	return TRUE;
 }
 
 
@@ -968,6 +1365,103 @@ Bool RecorderClass::isPlaybackInProgress() const
 	return isPlaybackMode() && m_nextFrame != -1;
 }
 
+/**
+ * Continue the playback at the first command on or after the given frame, using the frame table of the
+ * replay index. The skipped commands are never executed, so this is only allowed when analyzing a replay.
+ * A real playback needs every command to stay in sync and has to use snapshots to seek instead.
+ */
+Bool RecorderClass::seekPlaybackToFrame(UnsignedInt frame)
+{
+	if (!m_doingAnalysis || !isPlaybackInProgress() || m_file == nullptr)
+		return FALSE;
+
+	ReplayFrameOffsetVec offsets;
+	if (!readReplayFrameOffsets(m_currentReplayFilename, offsets))
+		return FALSE;
+
+	// The frames of the table are ascending, find the first one that is not before the requested frame.
+	size_t first = 0;
+	size_t last = offsets.size();
+	while (first < last)
+	{
+		const size_t middle = first + (last - first) / 2;
+		if (offsets[middle].frame < frame)
+			first = middle + 1;
+		else
+			last = middle;
+	}
+
+	if (first == offsets.size())
+	{
+		// No commands left after the requested frame.
+		m_nextFrame = -1;
+		stopPlayback();
+		return TRUE;
+	}
+
+	if (m_file->seek(offsets[first].filePosition, File::START) != offsets[first].filePosition)
+		return FALSE;
+
+	readNextFrame();
+	DEBUG_ASSERTCRASH(m_nextFrame == -1 || m_nextFrame == offsets[first].frame, ("Replay frame table does not match %s", m_currentReplayFilename.str()));
+	return TRUE;
+}
+
+/**
+ * Get the position of the current playback. This must be called in between two logic frames,
+ * when all commands of the previous frame have been processed.
+ */
+Bool RecorderClass::getPlaybackState(PlaybackState &state) const
+{
+	if (!isPlaybackMode() || m_file == nullptr)
+		return FALSE;
+
+	state.filename = m_currentReplayFilename;
+	state.filePosition = m_file->position();
+	state.nextFrame = m_nextFrame;
+	state.mode = m_mode;
+	state.crcInfo = m_crcInfo;
+	return TRUE;
+}
+
+/**
+ * Reopen the replay of a playback state and continue reading commands where the state was taken.
+ * Unlike playbackFile, this does not start a new game. It is used to continue a playback after
+ * the logic state was restored from a snapshot.
+ */
+Bool RecorderClass::restorePlaybackState(const PlaybackState &state)
+{
+	if (m_file != nullptr)
+	{
+		m_file->close();
+		m_file = nullptr;
+	}
+
+	m_mode = state.mode;
+
+	ReplayHeader header;
+	header.forPlayback = TRUE;
+	header.filename = state.filename;
+	if (!readReplayHeader(header))
+	{
+		m_mode = RECORDERMODETYPE_NONE;
+		return FALSE;
+	}
+
+	REPLAY_CRC_INTERVAL = m_gameInfo.getCRCInterval();
+
+	Int difficulty = 0;
+	m_file->read(&difficulty, sizeof(difficulty));
+	m_file->read(&m_originalGameMode, sizeof(m_originalGameMode));
+
+	m_file->seek(state.filePosition, File::START);
+	m_nextFrame = state.nextFrame;
+	m_crcInfo = state.crcInfo;
+	m_currentReplayFilename = state.filename;
+	m_playbackFrameCount = header.frameCount;
+	return TRUE;
+}
+
 AsciiString RecorderClass::getCurrentReplayFilename()
 {
 	if (isPlaybackMode())
@@ -1018,6 +1512,7 @@ void RecorderClass::handleCRCMessage(UnsignedInt newCRC, Int playerIndex, Bool f
 			// Note: We subtract the queue size from the frame number. This way we calculate the correct frame
 			// the mismatch first happened in case the NetCRCInterval is set to 1 during the game.
 			const UnsignedInt mismatchFrame = TheGameLogic->getFrame() - m_crcInfo.GetQueueSize() - 1;
+			m_crcInfo.setMismatchFrame((Int)mismatchFrame);
 
 			// Now also prints a UI message for it.
 			const UnicodeString mismatchDetailsStr = TheGameText->FETCH_OR_SUBSTITUTE("GUI:CRCMismatchDetails", L"InGame:%8.8X Replay:%8.8X Frame:%d");
@@ -1564,6 +2059,16 @@ AsciiString RecorderClass::getReplayArchiveDir()
 	return tmp;
 }
 
+/**
+ * returns the directory that holds the replay index files.
+ */
+AsciiString RecorderClass::getReplayIndexDir()
+{
+	AsciiString tmp = getReplayDir();
+	tmp.concat("Index\\");
+	return tmp;
+}
+
 /**
  * returns the file extension for the replay files.
  */
@@ -42,7 +42,9 @@
 #include "Common/Team.h"
 #include "Common/WellKnownKeys.h"
 #include "Common/XferLoad.h"
+#include "Common/XferLoadBuffer.h"
 #include "Common/XferSave.h"
+#include "Common/XferSaveBuffer.h"
 #include "GameClient/CampaignManager.h"
 #include "GameClient/GadgetListBox.h"
 #include "GameClient/GameClient.h"
@@ -617,6 +619,113 @@ SaveCode GameState::saveGame( AsciiString filename, UnicodeString desc,
 
 }
 
+// ------------------------------------------------------------------------------------------------
+/** Save the game state into a memory buffer instead of a save file. The data is the same as
+	* in a save file, but there is no user interaction and the save game info is left as it was. */
+// ------------------------------------------------------------------------------------------------
+SaveCode GameState::saveGameToBuffer( std::vector<UnsignedByte> &buffer )
+{
+
+	SaveGameInfo *gameInfo = getSaveGameInfo();
+	const SaveGameInfo previousGameInfo = *gameInfo;
+	gameInfo->saveFileType = SAVE_FILE_TYPE_NORMAL;
+	gameInfo->missionMapName.clear();
+
+	XferSaveBuffer xferSave;
+	xferSave.open( "GameStateBuffer" );
+
+	try
+	{
+
+		xferSaveData( &xferSave, SNAPSHOT_SAVELOAD );
+
+	}
+	catch( ... )
+	{
+
+		DEBUG_LOG(( "GameState::saveGameToBuffer - Error saving game state" ));
+		xferSave.close();
+		*gameInfo = previousGameInfo;
+		return SC_ERROR;
+
+	}
+
+	xferSave.close();
+	xferSave.swapBuffer( buffer );
+	*gameInfo = previousGameInfo;
+
+	return SC_OK;
+
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Load a game state from a buffer written by saveGameToBuffer. Unlike loadGame, this does not
+	* reset the engine, so that the caller can restore systems that are not part of the game state
+	* (such as the replay playback) in between. */
+// ------------------------------------------------------------------------------------------------
+SaveCode GameState::loadGameFromBuffer( const std::vector<UnsignedByte> &buffer )
+{
+
+	if( buffer.empty() )
+		return SC_INVALID_DATA;
+
+	// the map of the game state is extracted into the save directory
+	CreateDirectory( getSaveDirectory().str(), nullptr );
+
+	// clear the save directory of any temporary "scratch pad" maps
+	TheGameStateMap->clearScratchPadMaps();
+
+	XferLoadBuffer xferLoad( &buffer[ 0 ], (Int)buffer.size() );
+	xferLoad.open( "GameStateBuffer" );
+
+	// lock creation of new ghost objects
+	TheGhostObjectManager->saveLockGhostObjects( TRUE );
+
+	LatchRestore<Bool> inLoadGame(m_isInLoadGame, TRUE);
+
+	// load the save data
+	Bool error = FALSE;
+	try
+	{
+
+		xferSaveData( &xferLoad, SNAPSHOT_SAVELOAD );
+
+	}
+	catch( ... )
+	{
+		error = TRUE;
+	}
+
+	xferLoad.close();
+
+	// un-savelock the ghost objects
+	TheGhostObjectManager->saveLockGhostObjects( FALSE );
+
+	try
+	{
+		// do the post-process from a save game load
+		gameStatePostProcessLoad();
+	}
+	catch (...)
+	{
+		error = TRUE;
+	}
+
+	if( error == TRUE )
+	{
+
+		DEBUG_LOG(( "GameState::loadGameFromBuffer - Error loading game state" ));
+		if (TheGameLogic->isInGame())
+			TheGameLogic->clearGameData( FALSE );
+		TheGameEngine->reset();
+		return SC_INVALID_DATA;
+
+	}
+
+	return SC_OK;
+
+}
+
 // ------------------------------------------------------------------------------------------------
 /** A mission save */
 // ------------------------------------------------------------------------------------------------
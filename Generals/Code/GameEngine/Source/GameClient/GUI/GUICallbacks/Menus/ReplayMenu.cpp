@@ -35,6 +35,7 @@
 #include "Common/FileSystem.h"
 #include "Common/GameEngine.h"
 #include "Common/GameState.h"
+#include "Common/GlobalData.h"
 #include "Common/Recorder.h"
 #include "Common/version.h"
 #include "GameClient/WindowLayout.h"
@@ -110,7 +111,7 @@ static Bool readReplayMapInfo(const AsciiString& filename, RecorderClass::Replay
 	header.forPlayback = FALSE;
 	header.filename = filename;
 
-	if (TheRecorder != nullptr && TheRecorder->readReplayHeader(header))
+	if (TheRecorder != nullptr && TheRecorder->readReplayIndex(header))
 	{
 		if (ParseAsciiStringToGameInfo(&info, header.gameOptions))
 		{
@@ -695,7 +696,9 @@ WindowMsgHandledType ReplayMenuSystem( GameWindow *window, UnsignedInt msg,
 
 					AsciiString asciiFilename;
 					asciiFilename.translate(filename);
-					if (TheRecorder->analyzeReplay(asciiFilename))
+					// -replaySeek also sets the frame to start analyzing at.
+					const UnsignedInt startFrame = TheGlobalData->m_simulateReplaySeekFrame > 0 ? (UnsignedInt)TheGlobalData->m_simulateReplaySeekFrame : 0;
+					if (TheRecorder->analyzeReplay(asciiFilename, startFrame))
 					{
 						do
 						{
@@ -786,6 +789,10 @@ void deleteReplay()
 		errorStr.translate(translate);
 		MessageBoxOk(TheGameText->fetch("GUI:Error"),errorStr, nullptr);
 	}
+	else
+	{
+		RecorderClass::deleteReplayIndex(translate);
+	}
 	//Load the listbox shiznit
 	GadgetListBoxReset(listboxReplayFiles);
 	PopulateReplayFileListbox(listboxReplayFiles);
@@ -2183,11 +2183,12 @@ const WaterHandle* TerrainLogic::getWaterHandle( Real x, Real y )
 	iLoc.y = REAL_TO_INT_FLOOR( y + 0.5f );
 	iLoc.z = 0;
 
-	// Look for water areas in the polygon triggers
-	for( PolygonTrigger *pTrig = PolygonTrigger::getFirstPolygonTrigger();
-			 pTrig;
-			 pTrig = pTrig->getNext() )
+	// Look for water areas in the polygon triggers near the point
+	PolygonTrigger * const *candidates;
+	Int numCandidates = PolygonTrigger::getPolygonTriggerCandidates( iLoc, candidates );
+	for( Int c = 0; c < numCandidates; ++c )
 	{
+		PolygonTrigger *pTrig = candidates[ c ];
 
 		if( !pTrig->isWaterArea() )
 			continue;
@@ -1825,6 +1825,10 @@ void Object::setEffectivelyDead(Bool dead)
 	else
 		BitClear(m_privateStatus, EFFECTIVELY_DEAD);
 
+	// Ronin @performance 16/10/2026 Named unit script conditions read the death state of named objects.
+	if (TheScriptEngine && m_name.isNotEmpty())
+		TheScriptEngine->notifyOfScriptStateChange(SCRIPT_STATE_NAMED_UNITS);
+
 	if (dead)
 	{
 		if( m_radarData )
@@ -2380,8 +2384,11 @@ void Object::setTriggerAreaFlagsForChangeInPosition()
 
 	m_iPos = iPos;
 
-	for (const PolygonTrigger *pTrig = PolygonTrigger::getFirstPolygonTrigger(); pTrig; pTrig = pTrig->getNext())
+	PolygonTrigger * const *candidates;
+	Int numCandidates = PolygonTrigger::getPolygonTriggerCandidates(m_iPos, candidates);
+	for (Int c = 0; c < numCandidates; c++)
 	{
+		const PolygonTrigger *pTrig = candidates[c];
 		Bool skip = false;
 		for (i = 0; i < m_numTriggerAreasActive; i++)
 		{
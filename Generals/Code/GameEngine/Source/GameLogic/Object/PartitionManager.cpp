@@ -1226,6 +1226,8 @@ PartitionCell::PartitionCell()
 	m_cellX = m_cellY = 0;
 	m_firstCoiInCell = nullptr;
 	m_coiCount = 0;
+	m_isQueuedForClientShroud = FALSE;
+	m_clientShroudBeforeQueue = CELLSHROUD_SHROUDED;
 #ifdef PM_CACHE_TERRAIN_HEIGHT
 	m_loTerrainZ = HUGE_DIST;		// huge positive
 	m_hiTerrainZ = -HUGE_DIST;	// huge negative
@@ -1290,9 +1292,8 @@ void PartitionCell::addLooker(Int playerIndex)
 
 		if( playerIndex == rts::getObservedOrLocalPlayer()->getPlayerIndex() )
 		{
-			// and if this is the local player, do the Client update.
-			TheDisplay->setShroudLevel(m_cellX, m_cellY, newShroud);
-			TheRadar->setShroudLevel(m_cellX, m_cellY, newShroud);
+			// and if this is the local player, queue the Client update.
+			queueClientShroudUpdate( oldShroud );
 		}
 	}
 }
@@ -1326,9 +1327,8 @@ void PartitionCell::removeLooker(Int playerIndex)
 
 		if( playerIndex == rts::getObservedOrLocalPlayer()->getPlayerIndex() )
 		{
-			// and if this is the local player, do the Client update.
-			TheDisplay->setShroudLevel(m_cellX, m_cellY, newShroud);
-			TheRadar->setShroudLevel(m_cellX, m_cellY, newShroud);
+			// and if this is the local player, queue the Client update.
+			queueClientShroudUpdate( oldShroud );
 		}
 	}
 }
@@ -1354,12 +1354,33 @@ void PartitionCell::addShrouder( Int playerIndex )
 		// and update the client if we are on the local player
 		if( playerIndex == rts::getObservedOrLocalPlayer()->getPlayerIndex() )
 		{
-			TheDisplay->setShroudLevel(m_cellX, m_cellY, newShroud);
-			TheRadar->setShroudLevel(m_cellX, m_cellY, newShroud);
+			queueClientShroudUpdate( oldShroud );
 		}
 	}
 }
 
+//-----------------------------------------------------------------------------
+// Ronin @performance 16/10/2026 Moving units reveal and cover the same cells many times per frame.
+// Instead of pushing every edge to the display and the radar, the cell remembers what the client showed
+// before its first edge and the PartitionManager sends the net change once per logic frame.
+void PartitionCell::queueClientShroudUpdate( CellShroudStatus oldShroud )
+{
+	if( !m_isQueuedForClientShroud )
+	{
+		m_isQueuedForClientShroud = TRUE;
+		m_clientShroudBeforeQueue = oldShroud;
+		ThePartitionManager->friend_queueClientShroudUpdate( this );
+	}
+}
+
+//-----------------------------------------------------------------------------
+CellShroudStatus PartitionCell::friend_dequeueClientShroudUpdate()
+{
+	DEBUG_ASSERTCRASH( m_isQueuedForClientShroud, ("Cell is not queued for a client shroud update") );
+	m_isQueuedForClientShroud = FALSE;
+	return m_clientShroudBeforeQueue;
+}
+
 //-----------------------------------------------------------------------------
 void PartitionCell::removeShrouder( Int playerIndex )
 {
@@ -2763,6 +2784,7 @@ void PartitionManager::shutdown()
 #endif
 
 	resetPendingUndoShroudRevealQueue();
+	resetQueuedClientShroudUpdates();
 
 	delete [] m_cells;
 	m_cells = nullptr;
@@ -3092,6 +3114,9 @@ void PartitionManager::refreshShroudForLocalPlayer()
 	TheDisplay->clearShroud();
 	TheRadar->clearShroud();
 
+	// every cell is sent below, so the queued updates are obsolete.
+	resetQueuedClientShroudUpdates();
+
 	if (m_totalCellCount != 0)
 	{
 		const Int playerIndex = rts::getObservedOrLocalPlayer()->getPlayerIndex();
@@ -3110,6 +3135,42 @@ void PartitionManager::refreshShroudForLocalPlayer()
 	}
 }
 
+//-----------------------------------------------------------------------------
+void PartitionManager::processQueuedClientShroudUpdates()
+{
+	if (m_queuedClientShroudCells.empty())
+		return;
+
+	// This is a drawing refresh only, and so is allowed to use the Local Player.
+	const Int playerIndex = rts::getObservedOrLocalPlayer()->getPlayerIndex();
+	TheRadar->beginSetShroudLevel();
+
+	for (size_t i = 0; i < m_queuedClientShroudCells.size(); ++i)
+	{
+		PartitionCell *cell = m_queuedClientShroudCells[i];
+		const CellShroudStatus oldShroud = cell->friend_dequeueClientShroudUpdate();
+		const CellShroudStatus newShroud = cell->getShroudStatusForPlayer(playerIndex);
+		if (newShroud == oldShroud)
+			continue;	// revealed and covered again, the client already shows this
+
+		TheDisplay->setShroudLevel(cell->getCellX(), cell->getCellY(), newShroud);
+		TheRadar->setShroudLevel(cell->getCellX(), cell->getCellY(), newShroud);
+	}
+
+	TheRadar->endSetShroudLevel();
+	m_queuedClientShroudCells.clear();
+}
+
+//-----------------------------------------------------------------------------
+void PartitionManager::resetQueuedClientShroudUpdates()
+{
+	for (size_t i = 0; i < m_queuedClientShroudCells.size(); ++i)
+	{
+		m_queuedClientShroudCells[i]->friend_clearClientShroudUpdate();
+	}
+	m_queuedClientShroudCells.clear();
+}
+
 //-----------------------------------------------------------------------------
 CellShroudStatus PartitionManager::getShroudStatusForPlayer(Int playerIndex, Int x, Int y) const
 {
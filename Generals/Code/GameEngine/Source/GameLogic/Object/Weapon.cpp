@@ -1174,14 +1174,18 @@ void WeaponTemplate::processHistoricDamage(const Object* source, const Coord3D*
 		Int count = 0;
 		UnsignedInt frameNow = TheGameLogic->getFrame();
 		UnsignedInt oldestThatWillCount = frameNow - m_historicBonusTime; // Anything before this frame is "more than two seconds ago" eg
-		for( HistoricWeaponDamageList::const_iterator it = m_historicDamage.begin(); it != m_historicDamage.end(); ++it )
+		// Ronin @performance 16/10/2026 The count can not reach the bonus count with fewer entries, so skip the scan.
+		if( (Int)m_historicDamage.size() >= m_historicBonusCount - 1 )
 		{
-			if( it->frame >= oldestThatWillCount &&
-					is2DDistSquaredLessThan( *pos, it->location, radSqr ) )
+			for( HistoricWeaponDamageList::const_iterator it = m_historicDamage.begin(); it != m_historicDamage.end(); ++it )
 			{
-				// This one is close enough in time and distance, so count it. This is tracked by template since it applies
-				// across units, so don't try to clear historicDamage on success in here.
-				++count;
+				if( it->frame >= oldestThatWillCount &&
+						is2DDistSquaredLessThan( *pos, it->location, radSqr ) )
+				{
+					// This one is close enough in time and distance, so count it. This is tracked by template since it applies
+					// across units, so don't try to clear historicDamage on success in here.
+					++count;
+				}
 			}
 		}
 
@@ -1253,6 +1257,8 @@ void WeaponTemplate::dealDamageInternal(ObjectID sourceID, ObjectID victimID, co
 	if (victimID == 0 && pos == nullptr)	// must have some sort of destination
 		return;
 
+	WeaponStore::AreaDamageStatsScope statsScope;
+
 	Object *source = TheGameLogic->findObjectByID(sourceID);	// might be null...
 
 	processHistoricDamage(source, pos);
@@ -1301,6 +1307,23 @@ void WeaponTemplate::dealDamageInternal(ObjectID sourceID, ObjectID victimID, co
 		}
 		MemoryPoolObjectHolder hold(iter);
 
+		// if the damage-dealer is a projectile, designate the damage as done by its launcher, not the projectile.
+		// this is much more useful for the AI...
+		// Ronin @performance 16/10/2026 Look the launcher up once per detonation instead of once per victim.
+		ObjectID damageSourceID = sourceID;
+		if (source && source->isKindOf(KINDOF_PROJECTILE))
+		{
+			for (BehaviorModule** u = source->getBehaviorModules(); *u; ++u)
+			{
+				ProjectileUpdateInterface* pui = (*u)->getProjectileUpdateInterface();
+				if (pui != nullptr)
+				{
+					damageSourceID = pui->projectileGetLauncherID();
+					break;
+				}
+			}
+		}
+
 		for (; curVictim != nullptr; curVictim = iter ? iter->nextWithNumeric(&curVictimDistSqr) : nullptr)
 		{
 			Bool killSelf = false;
@@ -1391,21 +1414,9 @@ void WeaponTemplate::dealDamageInternal(ObjectID sourceID, ObjectID victimID, co
 				//}
 			}
 
-			// if the damage-dealer is a projectile, designate the damage as done by its launcher, not the projectile.
-			// this is much more useful for the AI...
-			if (source && source->isKindOf(KINDOF_PROJECTILE))
-			{
-				for (BehaviorModule** u = source->getBehaviorModules(); *u; ++u)
-				{
-					ProjectileUpdateInterface* pui = (*u)->getProjectileUpdateInterface();
-					if (pui != nullptr)
-					{
-						damageInfo.in.m_sourceID = pui->projectileGetLauncherID();
-						break;
-					}
-				}
-			}
+			damageInfo.in.m_sourceID = damageSourceID;
 
+			statsScope.addVictim();
 			curVictim->attemptDamage(&damageInfo);
 			//DEBUG_ASSERTLOG(damageInfo.out.m_noEffect, ("WeaponTemplate::dealDamageInternal: dealt to %s %08lx: attempted %f, actual %f (%f)",
 			//	curVictim->getTemplate()->getName().str(),curVictim,
@@ -1423,6 +1434,12 @@ void WeaponTemplate::dealDamageInternal(ObjectID sourceID, ObjectID victimID, co
 //-------------------------------------------------------------------------------------------------
 WeaponStore::WeaponStore()
 {
+	m_weaponDDISequence = 0;
+	m_areaDamageDetonations = 0;
+	m_areaDamageVictims = 0;
+	m_areaDamageTime = 0;
+	m_areaDamageDepth = 0;
+	m_areaDamageStatsEnabled = FALSE;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -1538,27 +1555,45 @@ WeaponTemplate *WeaponStore::newOverride(WeaponTemplate *weaponTemplate)
 //-------------------------------------------------------------------------------------------------
 void WeaponStore::update()
 {
-	for (std::list<WeaponDelayedDamageInfo>::iterator ddi = m_weaponDDI.begin(); ddi != m_weaponDDI.end(); )
+	UnsignedInt curFrame = TheGameLogic->getFrame();
+	if (m_weaponDDI.empty() || m_weaponDDI.begin()->first > curFrame)
+		return;
+
+	// Take the due entries out of the map first. Dealing damage can queue new delayed damage,
+	// which is always due in a later frame and goes to another bucket.
+	Int dueBuckets = 0;
+	while (!m_weaponDDI.empty() && m_weaponDDI.begin()->first <= curFrame)
 	{
-		UnsignedInt curFrame = TheGameLogic->getFrame();
-		if (curFrame >= ddi->m_delayDamageFrame)
-		{
-			// we never do projectile-detonation-damage via this code path.
-			const Bool isProjectileDetonation = false;
-			ddi->m_delayedWeapon->dealDamageInternal(ddi->m_delaySourceID, ddi->m_delayIntendedVictimID, &ddi->m_delayDamagePos, ddi->m_bonus, isProjectileDetonation);
-			ddi = m_weaponDDI.erase(ddi);
-		}
+		WeaponDelayedDamageVec& bucket = m_weaponDDI.begin()->second;
+		if (dueBuckets == 0)
+			m_dueWeaponDDI.swap(bucket);
 		else
-		{
-			++ddi;
-		}
+			m_dueWeaponDDI.insert(m_dueWeaponDDI.end(), bucket.begin(), bucket.end());
+		m_weaponDDI.erase(m_weaponDDI.begin());
+		++dueBuckets;
+	}
+
+	// Entries of more than one frame are due only if updates were skipped. Deal them in the order
+	// they were queued, like the former list did.
+	if (dueBuckets > 1)
+		std::sort(m_dueWeaponDDI.begin(), m_dueWeaponDDI.end(), DelayedDamageSequenceLess());
+
+	for (size_t i = 0; i < m_dueWeaponDDI.size(); ++i)
+	{
+		const WeaponDelayedDamageInfo& ddi = m_dueWeaponDDI[i];
+		// we never do projectile-detonation-damage via this code path.
+		const Bool isProjectileDetonation = false;
+		ddi.m_delayedWeapon->dealDamageInternal(ddi.m_delaySourceID, ddi.m_delayIntendedVictimID, &ddi.m_delayDamagePos, ddi.m_bonus, isProjectileDetonation);
 	}
+	m_dueWeaponDDI.clear();
 }
 
 //-------------------------------------------------------------------------------------------------
 void WeaponStore::deleteAllDelayedDamage()
 {
 	m_weaponDDI.clear();
+	m_dueWeaponDDI.clear();
+	m_weaponDDISequence = 0;
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -1590,6 +1625,57 @@ void WeaponStore::reset()
 
 	deleteAllDelayedDamage();
 	resetWeaponTemplates();
+
+	m_areaDamageDetonations = 0;
+	m_areaDamageVictims = 0;
+	m_areaDamageTime = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+void WeaponStore::getAreaDamageStats(UnsignedInt *detonations, UnsignedInt *victims, Real *timeMsec) const
+{
+	LARGE_INTEGER freq;
+	QueryPerformanceFrequency(&freq);
+	*detonations = m_areaDamageDetonations;
+	*victims = m_areaDamageVictims;
+	*timeMsec = (Real)((double)m_areaDamageTime * 1000.0 / (double)freq.QuadPart);
+}
+
+//-------------------------------------------------------------------------------------------------
+WeaponStore::AreaDamageStatsScope::AreaDamageStatsScope() : m_startTime(0)
+{
+	m_active = TheWeaponStore != nullptr && TheWeaponStore->m_areaDamageStatsEnabled;
+	if (!m_active)
+		return;
+
+	++TheWeaponStore->m_areaDamageDetonations;
+	if (TheWeaponStore->m_areaDamageDepth++ == 0)
+	{
+		LARGE_INTEGER startTime;
+		QueryPerformanceCounter(&startTime);
+		m_startTime = startTime.QuadPart;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+WeaponStore::AreaDamageStatsScope::~AreaDamageStatsScope()
+{
+	if (!m_active)
+		return;
+
+	if (--TheWeaponStore->m_areaDamageDepth == 0)
+	{
+		LARGE_INTEGER endTime;
+		QueryPerformanceCounter(&endTime);
+		TheWeaponStore->m_areaDamageTime += endTime.QuadPart - m_startTime;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+void WeaponStore::AreaDamageStatsScope::addVictim()
+{
+	if (m_active)
+		++TheWeaponStore->m_areaDamageVictims;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -1602,7 +1688,8 @@ void WeaponStore::setDelayedDamage(const WeaponTemplate *weapon, const Coord3D*
 	wi.m_delaySourceID = sourceID;
 	wi.m_delayIntendedVictimID = victimID;
 	wi.m_bonus = bonus;
-	m_weaponDDI.push_back(wi);
+	wi.m_sequence = m_weaponDDISequence++;
+	m_weaponDDI[whichFrame].push_back(wi);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -385,6 +385,7 @@ m_skirmishHumanPlayer(nullptr),
 m_fade(FADE_NONE),
 m_freezeByScript(FALSE),
 m_frameObjectCountChanged(0),
+m_conditionDependencyTracking(TRUE),
 m_closeWindowTimer(0),
 m_curFadeFrame(0),
 m_curFadeValue(0.0f),
@@ -402,6 +403,9 @@ m_ChooseVictimAlwaysUsesNormal(false)
 {
 	st_CanAppCont = true;
 	st_LastCurrentFrame = st_CurrentFrame = 0;
+	for (Int i = 0; i < SCRIPT_STATE_COUNT; ++i) {
+		m_scriptStateVersions[i] = 0;
+	}
 	// By default, difficulty should be normal.
 	setGlobalDifficulty(DIFFICULTY_NORMAL);
 
@@ -4639,9 +4643,10 @@ void ScriptEngine::reset()
 				}
 			}
 			if (maxScript) {
-				DEBUG_LOG(("   SCRIPT %s total time %f seconds,\n        evaluated %d times, avg execution %2.3f msec (Goal less than 0.05)",
+				DEBUG_LOG(("   SCRIPT %s total time %f seconds,\n        evaluated %d times, skipped %d times, avg execution %2.3f msec (Goal less than 0.05)",
 					maxScript->getName().str(),
-					maxScript->getConditionTime(), maxScript->getConditionCount(), 1000*maxScript->getConditionTime()/maxScript->getConditionCount()) );
+					maxScript->getConditionTime(), maxScript->getConditionCount(), maxScript->getConditionSkippedCount(),
+					1000*maxScript->getConditionTime()/maxScript->getConditionCount()) );
 				maxScript->addToConditionTime(-2*maxTime); // reset to negative.
 			}
 
@@ -4680,12 +4685,13 @@ void ScriptEngine::reset()
 	m_namedReveals.clear();
 
 	// Clear the named objects list.
- 	m_namedObjects.clear();
+	clearNamedObjects();
 
 	m_completedVideo.clear();
 	m_testingSpeech.clear();
 	m_testingAudio.clear();
 	m_uiInteractions.clear();
+	invalidateScriptStateVersions();
 	for (i=0; i<MAX_PLAYER_COUNT; ++i)
 	{
 		m_triggeredSpecialPowers[i].clear();
@@ -4741,6 +4747,7 @@ void ScriptEngine::newMap()
 	m_testingSpeech.clear();
 	m_testingAudio.clear();
 	m_uiInteractions.clear();
+	invalidateScriptStateVersions();
 	for (i=0; i<MAX_PLAYER_COUNT; ++i)
 	{
 		m_triggeredSpecialPowers[i].clear();
@@ -4758,11 +4765,13 @@ void ScriptEngine::newMap()
 		Script *pScr;
 		for (pScr = pSL->getScript(); pScr; pScr=pScr->getNext()) {
 			checkConditionsForTeamNames(pScr);
+			checkConditionDependencies(pScr);
 		}
 		ScriptGroup *pGroup;
 		for (pGroup = pSL->getScriptGroup(); pGroup; pGroup=pGroup->getNext()) {
 			for (pScr = pGroup->getScript(); pScr; pScr=pScr->getNext()) {
 				checkConditionsForTeamNames(pScr);
+				checkConditionDependencies(pScr);
 			}
 		}
 	}
@@ -4848,14 +4857,19 @@ void ScriptEngine::update()
 	// Update any countdown timers.
 	Int i;
 	// Note - counters start at 1.  0 means not assigned.
+	Bool countersChanged = false;
 	for (i=1; i<m_numCounters; i++) {
 		if (m_counters[i].isCountdownTimer) {
 			// If counter has any time left, decrement.  Counters go to -1 and stop.
 			if (m_counters[i].value >= 0) {
 				m_counters[i].value--;
+				countersChanged = true;
 			}
 		}
 	}
+	if (countersChanged) {
+		notifyOfScriptStateChange(SCRIPT_STATE_COUNTERS);
+	}
 
 	// Evaluate the scripts.
 	for (i=0; i<TheSidesList->getNumSides(); i++) {
@@ -4881,7 +4895,10 @@ void ScriptEngine::update()
 	ThePlayerList->updateTeamStates();
 
 	// Clear the UI Interaction flags.
-	m_uiInteractions.clear();
+	if (!m_uiInteractions.empty()) {
+		m_uiInteractions.clear();
+		notifyOfScriptStateChange(SCRIPT_STATE_FLAGS);
+	}
 
 	// update all sequential stuff.
 	evaluateAndProgressAllSequentialScripts();
@@ -5058,6 +5075,7 @@ void ScriptEngine::clearFlag(const AsciiString &name)
 		for (i=1; i<m_numFlags; i++) {
 			if ((modName==m_flags[i].name)) {
 				m_flags[i].value = FALSE;
+				notifyOfScriptStateChange(SCRIPT_STATE_FLAGS);
 			}
 		}
 	}
@@ -5301,10 +5319,9 @@ Object * ScriptEngine::getUnitNamed(const AsciiString& unitName)
 		return m_conditionObject;
 	}
 
-	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
-		if (unitName == (it->first)) {
-			return it->second;
-		}
+	const Int index = findNamedObject(unitName);
+	if (index >= 0) {
+		return m_namedObjects[index].second;
 	}
 	return nullptr;
 }
@@ -5314,10 +5331,9 @@ Object * ScriptEngine::getUnitNamed(const AsciiString& unitName)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptEngine::didUnitExist(const AsciiString& unitName)
 {
-	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
-		if (unitName == (it->first)) {
-			return (it->second == nullptr);
-		}
+	const Int index = findNamedObject(unitName);
+	if (index >= 0) {
+		return (m_namedObjects[index].second == nullptr);
 	}
 	return false;
 }
@@ -5440,6 +5456,7 @@ Int ScriptEngine::allocateCounter( const AsciiString& name)
 		m_counters[m_numCounters].name = name;
 		i = m_numCounters;
 		m_numCounters++;
+		notifyOfScriptStateChange(SCRIPT_STATE_COUNTERS);
 		return(i);
 	}
 	return 0; // Shouldn't ever happen.
@@ -5578,6 +5595,7 @@ Int ScriptEngine::allocateFlag( const AsciiString& name)
 		m_flags[m_numFlags].name = name;
 		i = m_numFlags;
 		m_numFlags++;
+		notifyOfScriptStateChange(SCRIPT_STATE_FLAGS);
 		return(i);
 	}
 	return 0; // Shouldn't ever happen.
@@ -5666,6 +5684,7 @@ void ScriptEngine::setCounter( ScriptAction *pAction )
 	}
 	Int value = pAction->getParameter(1)->getInt();
 	m_counters[counterNdx].value = value;
+	notifyOfScriptStateChange(SCRIPT_STATE_COUNTERS);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -5734,6 +5753,7 @@ void ScriptEngine::addCounter( ScriptAction *pAction )
 		pAction->getParameter(1)->friend_setInt(counterNdx);
 	}
 	m_counters[counterNdx].value += value;
+	notifyOfScriptStateChange(SCRIPT_STATE_COUNTERS);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -5749,6 +5769,7 @@ void ScriptEngine::subCounter( ScriptAction *pAction )
 		pAction->getParameter(1)->friend_setInt(counterNdx);
 	}
 	m_counters[counterNdx].value -= value;
+	notifyOfScriptStateChange(SCRIPT_STATE_COUNTERS);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -5793,6 +5814,7 @@ void ScriptEngine::setFlag( ScriptAction *pAction )
 	}
 	Bool value = pAction->getParameter(1)->getInt();
 	m_flags[flagNdx].value = value;
+	notifyOfScriptStateChange(SCRIPT_STATE_FLAGS);
 }
 
 
@@ -6055,6 +6077,7 @@ void ScriptEngine::setTimer( ScriptAction *pAction, Bool millisecondTimer, Bool
 		m_counters[counterNdx].value = value;
 	}
 	m_counters[counterNdx].isCountdownTimer = true;
+	notifyOfScriptStateChange(SCRIPT_STATE_COUNTERS);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6069,6 +6092,7 @@ void ScriptEngine::pauseTimer( ScriptAction *pAction )
 		pAction->getParameter(0)->friend_setInt(counterNdx);
 	}
 	m_counters[counterNdx].isCountdownTimer = false;
+	notifyOfScriptStateChange(SCRIPT_STATE_COUNTERS);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6084,6 +6108,7 @@ void ScriptEngine::restartTimer( ScriptAction *pAction )
 	}
 	if (m_counters[counterNdx].value > 0) {
 		m_counters[counterNdx].isCountdownTimer = true;
+		notifyOfScriptStateChange(SCRIPT_STATE_COUNTERS);
 	}
 }
 
@@ -6109,6 +6134,7 @@ void ScriptEngine::adjustTimer( ScriptAction *pAction, Bool millisecondTimer, Bo
 			value = -value;
 		m_counters[counterNdx].value += value;
 	}
+	notifyOfScriptStateChange(SCRIPT_STATE_COUNTERS);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6240,6 +6266,58 @@ void ScriptEngine::checkConditionsForTeamNames(Script *pScript)
 
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Finds the state the conditions of a script read. Only conditions that read nothing but counters,
+flags or named units are tracked, any other condition makes the script evaluate every time. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::checkConditionDependencies(Script *pScript)
+{
+	UnsignedInt dependencies = 0;
+	OrCondition *pOr;
+	for (pOr = pScript->getOrCondition(); pOr; pOr = pOr->getNextOrCondition()) {
+		Condition *pCondition;
+		for (pCondition = pOr->getFirstAndCondition(); pCondition; pCondition = pCondition->getNext()) {
+			switch (pCondition->getConditionType()) {
+				case Condition::CONDITION_FALSE:
+				case Condition::CONDITION_TRUE:
+					break;
+				case Condition::COUNTER:
+				case Condition::TIMER_EXPIRED:
+					dependencies |= (1 << SCRIPT_STATE_COUNTERS);
+					break;
+				case Condition::FLAG:
+					dependencies |= (1 << SCRIPT_STATE_FLAGS);
+					break;
+				case Condition::NAMED_DESTROYED:
+				case Condition::NAMED_NOT_DESTROYED:
+				case Condition::NAMED_DYING:
+				case Condition::NAMED_TOTALLY_DEAD:
+					// THIS_OBJECT depends on the calling object, which is not tracked.
+					if (pCondition->getNumParameters() < 1 || pCondition->getParameter(0)->getString() == THIS_OBJECT) {
+						pScript->setConditionDependencies(false, 0);
+						return;
+					}
+					dependencies |= (1 << SCRIPT_STATE_NAMED_UNITS);
+					break;
+				default:
+					pScript->setConditionDependencies(false, 0);
+					return;
+			}
+		}
+	}
+	pScript->setConditionDependencies(true, dependencies);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Invalidates the cached condition results of all scripts. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::invalidateScriptStateVersions()
+{
+	for (Int i = 0; i < SCRIPT_STATE_COUNT; ++i) {
+		notifyOfScriptStateChange((ScriptStateType)i);
+	}
+}
+
 //-------------------------------------------------------------------------------------------------
 /** Executes a script. */
 //-------------------------------------------------------------------------------------------------
@@ -6405,6 +6483,7 @@ void ScriptEngine::addObjectToCache(Object* pNewObject)
 				AppendDebugMessage(newNameForDead, FALSE);
 				DEBUG_LOG((newNameForDead.str()));
 				it->second = pNewObject;
+				notifyOfScriptStateChange(SCRIPT_STATE_NAMED_UNITS);
 				return;
 			} else {
 				DEBUG_CRASH(("Attempting to assign the name '%s' to object (%d) of type '%s',"
@@ -6416,16 +6495,12 @@ void ScriptEngine::addObjectToCache(Object* pNewObject)
 		}
 
 		if (pNewObject == (it->second)) {
-			it->first = objName;
+			renameNamedObject((Int)(it - m_namedObjects.begin()), objName);
 			return;
 		}
 	}
 
-	NamedRequest req;
-	req.first = objName;
-	req.second = pNewObject;
-
-	m_namedObjects.push_back(req);
+	addNamedObject(objName, pNewObject);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6436,6 +6511,7 @@ void ScriptEngine::removeObjectFromCache( Object* pDeadObject )
 	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
 		if (pDeadObject == (it->second)) {
 			it->second = nullptr;	// Don't remove it, cause we want to check whether we ever knew a name later
+			notifyOfScriptStateChange(SCRIPT_STATE_NAMED_UNITS);
 			break;
 		}
 	}
@@ -6466,28 +6542,96 @@ void ScriptEngine::transferObjectName( const AsciiString& unitName, Object *pNew
 
 	pNewObject->setName(unitName); // make sure it has the correct name.
 
-	//Loop through the cached list and find the string entry. If found, change the object
-	//so it's pointing to the new one.
-	for( VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it )
+	//Find the cached string entry. If found, change the object so it's pointing to the new one.
+	const Int index = findNamedObject(unitName);
+	if( index >= 0 )
 	{
-		if( !unitName.compare( it->first ) )
+		NamedRequest& req = m_namedObjects[index];
+		Object* pOldObj = req.second;
+		if( pOldObj )
 		{
-			Object* pOldObj = it->second;
-			if( pOldObj )
-			{
-				// if you are transferring your name, you should also transfer any custom indicator color you have.
-				if (pOldObj->hasCustomIndicatorColor())
-					pNewObject->setCustomIndicatorColor(pOldObj->getIndicatorColor());
-				else
-					pNewObject->removeCustomIndicatorColor();
-			}
+			// if you are transferring your name, you should also transfer any custom indicator color you have.
+			if (pOldObj->hasCustomIndicatorColor())
+				pNewObject->setCustomIndicatorColor(pOldObj->getIndicatorColor());
+			else
+				pNewObject->removeCustomIndicatorColor();
+		}
 
-			it->second = pNewObject;
+		req.second = pNewObject;
+		notifyOfScriptStateChange(SCRIPT_STATE_NAMED_UNITS);
+	}
 
-			return;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Empties the named object cache and its index. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::clearNamedObjects()
+{
+	m_namedObjects.clear();
+	m_namedObjectIndex.clear();
+	notifyOfScriptStateChange(SCRIPT_STATE_NAMED_UNITS);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Appends an entry to the named object cache. Only the first entry of a name is indexed,
+		because that is the one the lookups have always returned. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::addNamedObject(const AsciiString& name, Object* obj)
+{
+	NamedRequest req;
+	req.first = name;
+	req.second = obj;
+
+	m_namedObjectIndex.insert(NamedObjectIndexMap::value_type(name, (Int)m_namedObjects.size()));
+	m_namedObjects.push_back(req);
+	notifyOfScriptStateChange(SCRIPT_STATE_NAMED_UNITS);
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Renames an entry of the named object cache and keeps the index pointing at the first entry of
+		the old and the new name. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::renameNamedObject(Int index, const AsciiString& name)
+{
+	NamedRequest& req = m_namedObjects[index];
+	if (req.first == name) {
+		return;
+	}
+
+	NamedObjectIndexMap::iterator oldIt = m_namedObjectIndex.find(req.first);
+	if (oldIt != m_namedObjectIndex.end() && oldIt->second == index) {
+		// Renames are rare, so just search for the next entry that still has the old name.
+		m_namedObjectIndex.erase(oldIt);
+		for (Int i = index + 1; i < (Int)m_namedObjects.size(); ++i) {
+			if (m_namedObjects[i].first == req.first) {
+				m_namedObjectIndex[req.first] = i;
+				break;
+			}
 		}
 	}
 
+	req.first = name;
+
+	NamedObjectIndexMap::iterator newIt = m_namedObjectIndex.find(name);
+	if (newIt == m_namedObjectIndex.end()) {
+		m_namedObjectIndex[name] = index;
+	} else if (newIt->second > index) {
+		newIt->second = index;
+	}
+	notifyOfScriptStateChange(SCRIPT_STATE_NAMED_UNITS);
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+Int ScriptEngine::findNamedObject(const AsciiString& name) const
+{
+	NamedObjectIndexMap::const_iterator it = m_namedObjectIndex.find(name);
+	if (it == m_namedObjectIndex.end()) {
+		return -1;
+	}
+	DEBUG_ASSERTCRASH(m_namedObjects[it->second].first == name, ("ScriptEngine::findNamedObject - index is out of sync for '%s'", name.str()));
+	return it->second;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6562,6 +6706,7 @@ void ScriptEngine::notifyOfAcquiredScience( Int playerIndex, ScienceType science
 void ScriptEngine::signalUIInteract(const AsciiString& hookName)
 {
 	m_uiInteractions.push_front(hookName);
+	notifyOfScriptStateChange(SCRIPT_STATE_FLAGS);
 #ifdef DEBUG_LOGGING
 	AppendDebugMessage(hookName, false); // don't bother in Release
 #endif
@@ -6881,6 +7026,19 @@ Bool ScriptEngine::evaluateConditions( Script *pScript, Team *thisTeam, Player *
 	if (thisTeam) player = thisTeam->getControllingPlayer();
 	if (player==nullptr) player=m_currentPlayer;
 	LatchRestore<Player*> latch2(m_currentPlayer, player);
+
+	// Ronin @performance 16/10/2026 Reuse the last result if none of the state the conditions read changed since.
+	// The versions are taken before the evaluation, so any change made while evaluating invalidates the result.
+	UnsignedInt stateVersions[SCRIPT_STATE_COUNT];
+	if (m_conditionDependencyTracking && pScript->areConditionDependenciesTracked()) {
+		Bool cachedValue;
+		if (pScript->getCachedConditionResult(m_scriptStateVersions, &cachedValue)) {
+			pScript->incrementConditionSkippedCount();
+			return cachedValue;
+		}
+		memcpy(stateVersions, m_scriptStateVersions, sizeof(stateVersions));
+	}
+
 	OrCondition *pConditionHead = pScript->getOrCondition();
 	Bool testValue = false;
 
@@ -6918,6 +7076,10 @@ Bool ScriptEngine::evaluateConditions( Script *pScript, Team *thisTeam, Player *
 	pScript->addToConditionTime(timeToEvaluate);
 #endif
 
+	if (m_conditionDependencyTracking && pScript->areConditionDependenciesTracked()) {
+		pScript->setCachedConditionResult(stateVersions, testValue);
+	}
+
 	return testValue; // If none of the or's fired, then it is false.
 }
 
@@ -7012,7 +7174,7 @@ const ConditionTemplate * ScriptEngine::getConditionTemplate( Int ndx )
 //-------------------------------------------------------------------------------------------------
 void ScriptEngine::createNamedCache()
 {
-	m_namedObjects.clear();
+	clearNamedObjects();
 
 	if( !TheGameLogic )
 	{
@@ -7022,10 +7184,7 @@ void ScriptEngine::createNamedCache()
 
 	while (pObj) {
 		if (!pObj->getName().isEmpty()) {
-			NamedRequest req;
-			req.first = pObj->getName();
-			req.second = pObj;
-			m_namedObjects.push_back(req);
+			addNamedObject(pObj->getName(), pObj);
 		}
 		pObj = pObj->getNextObject();
 	}
@@ -8302,13 +8461,11 @@ void ScriptEngine::xfer( Xfer *xfer )
 	}
 	else
 	{
-		NamedRequest req;
-
 		//
 		// list should be empty, it is legal for it to not be empty at this point
 		// according to John M., so we're clearing it now
 		//
-		m_namedObjects.clear();
+		clearNamedObjects();
 
 		// read each element
 		for( UnsignedShort i = 0; i < namedObjectsCount; ++i )
@@ -8329,9 +8486,7 @@ void ScriptEngine::xfer( Xfer *xfer )
 			}
 
 			// assign
-			req.first = namedObjectName;
-			req.second = obj;
-			m_namedObjects.push_back( req );
+			addNamedObject( namedObjectName, obj );
 
 		}
 
@@ -8623,6 +8778,8 @@ void ScriptEngine::xfer( Xfer *xfer )
 // ------------------------------------------------------------------------------------------------
 void ScriptEngine::loadPostProcess()
 {
+	// The loaded counters, flags and named objects were not tracked.
+	invalidateScriptStateVersions();
 
 	// Now that we've loaded everything, go through and set them all back in sync with what we
 	// currently think they should be.
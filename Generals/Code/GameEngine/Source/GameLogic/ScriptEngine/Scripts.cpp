@@ -897,6 +897,11 @@ m_hard(true),
 m_delayEvaluationSeconds(0),
 m_conditionTime(0),
 m_conditionExecutedCount(0),
+m_conditionSkippedCount(0),
+m_conditionDependenciesTracked(false),
+m_conditionDependencies(0),
+m_hasCachedConditionResult(false),
+m_cachedConditionResult(false),
 m_frameToEvaluateAt(0),
 m_isSubroutine(false),
 m_hasWarnings(false),
@@ -1066,6 +1071,9 @@ void Script::updateFrom(Script *pSrc)
 	deleteInstance(this->m_actionFalse);
 	this->m_actionFalse = pSrc->m_actionFalse;
 	pSrc->m_actionFalse = nullptr;
+
+	// The conditions changed, so ScriptEngine has to check them again.
+	setConditionDependencies(false, 0);
 }
 
 /**
@@ -1137,6 +1145,51 @@ void Script::deleteFalseAction(ScriptAction *pAct)
 }
 
 
+/**
+  Script::setConditionDependencies - Sets the state the conditions depend on, as found by ScriptEngine.
+	If the dependencies are not tracked, the conditions are evaluated every time.
+*/
+void Script::setConditionDependencies(Bool tracked, UnsignedInt dependencies)
+{
+	m_conditionDependenciesTracked = tracked;
+	m_conditionDependencies = dependencies;
+	m_hasCachedConditionResult = false;
+}
+
+/**
+  Script::getCachedConditionResult - Gets the last condition result, if none of the state the
+	conditions depend on changed since it was evaluated.
+*/
+Bool Script::getCachedConditionResult(const UnsignedInt *stateVersions, Bool *result) const
+{
+	if (!m_conditionDependenciesTracked || !m_hasCachedConditionResult) {
+		return false;
+	}
+	for (Int i = 0; i < SCRIPT_STATE_COUNT; ++i) {
+		if ((m_conditionDependencies & (1 << i)) && m_cachedConditionVersions[i] != stateVersions[i]) {
+			return false;
+		}
+	}
+	*result = m_cachedConditionResult;
+	return true;
+}
+
+/**
+  Script::setCachedConditionResult - Caches a condition result together with the state versions
+	it was evaluated at.
+*/
+void Script::setCachedConditionResult(const UnsignedInt *stateVersions, Bool result)
+{
+	if (!m_conditionDependenciesTracked) {
+		return;
+	}
+	for (Int i = 0; i < SCRIPT_STATE_COUNT; ++i) {
+		m_cachedConditionVersions[i] = stateVersions[i];
+	}
+	m_cachedConditionResult = result;
+	m_hasCachedConditionResult = true;
+}
+
 /**
   Script::getUiText - Creates the string to display in the scripts dialog box.
 */
@@ -259,6 +259,9 @@ GameLogic::GameLogic()
 	m_height = 0;
 	m_objList = nullptr;
 	m_curUpdateModule = nullptr;
+#if !RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER
+	clearSleepyUpdateWheel();
+#endif
 	m_nextObjID = INVALID_ID;
 	m_startNewGame = FALSE;
 	m_gameMode = GAME_NONE;
@@ -470,8 +473,14 @@ void GameLogic::reset()
 	for (std::vector<UpdateModulePtr>::iterator it = m_sleepyUpdates.begin(); it != m_sleepyUpdates.end(); ++it)
 	{
 		(*it)->friend_setIndexInLogic(-1);
+#if !RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER
+		(*it)->friend_setSleepySlotLinks(-1, nullptr, nullptr);
+#endif
 	}
 	m_sleepyUpdates.clear();
+#if !RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER
+	clearSleepyUpdateWheel();
+#endif
 	m_curUpdateModule = nullptr;
 
 	m_isScoringEnabled = TRUE;
@@ -2495,6 +2504,23 @@ inline void GameLogic::validateSleepyUpdate() const
 	#define SLEEPY_DEBUG
 #endif
 #ifdef SLEEPY_DEBUG
+#if !RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER
+	Int numLinked = 0;
+	for (Int slot = 0; slot < SLEEPY_WHEEL_SLOT_COUNT; ++slot)
+	{
+		for (UpdateModulePtr u = m_sleepyWheel[slot].head; u; u = u->friend_getNextInSleepySlot())
+		{
+			DEBUG_ASSERTCRASH(u->friend_getSleepySlot() == slot, ("sleepy slot mismatch: expected %d, got %d",slot,u->friend_getSleepySlot()));
+			DEBUG_ASSERTCRASH(slot >= SLEEPY_WHEEL1_FIRST_SLOT || u->friend_getPriority() < m_sleepyWheelTime + SLEEPY_WHEEL0_SIZE, ("sleepy wheel is munged"));
+			++numLinked;
+		}
+	}
+	DEBUG_ASSERTCRASH(numLinked == (Int)m_sleepyUpdates.size(), ("sleepy wheel count mismatch: expected %d, got %d",(Int)m_sleepyUpdates.size(),numLinked));
+	for (Int i = 0; i < (Int)m_sleepyUpdates.size(); ++i)
+	{
+		DEBUG_ASSERTCRASH(m_sleepyUpdates[i]->friend_getIndexInLogic() == i, ("index mismatch: expected %d, got %d",i,m_sleepyUpdates[i]->friend_getIndexInLogic()));
+	}
+#else
 	int sz = m_sleepyUpdates.size();
 	if (sz == 0)
 		return;
@@ -2528,6 +2554,7 @@ inline void GameLogic::validateSleepyUpdate() const
 			DEBUG_ASSERTCRASH(pri <= pri2, ("sleepyUpdates are munged (2)"));
 		}
 	}
+#endif // RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER
 #endif
 }
 
@@ -2538,6 +2565,11 @@ void GameLogic::eraseSleepyUpdate(Int i)
 
 	DEBUG_ASSERTCRASH(i >= 0 && i < m_sleepyUpdates.size(), ("bad sleepy idx"));
 
+#if !RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER
+	// the order of m_sleepyUpdates does not matter here, the wheel keeps the schedule
+	unlinkSleepyUpdate(m_sleepyUpdates[i]);
+#endif
+
 	// swap with the final item, toss the final item, then rebalance
 	m_sleepyUpdates[i]->friend_setIndexInLogic(-1);
 
@@ -2547,7 +2579,9 @@ void GameLogic::eraseSleepyUpdate(Int i)
 		m_sleepyUpdates[i] = m_sleepyUpdates[last];
 		m_sleepyUpdates[i]->friend_setIndexInLogic(i);
 		m_sleepyUpdates.pop_back();
+#if RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER
 		rebalanceSleepyUpdate(i);
+#endif
 	}
 	else
 	{
@@ -2689,6 +2723,7 @@ void GameLogic::remakeSleepyUpdate()
 {
 	USE_PERF_TIMER(SleepyMaintenance)
 
+#if RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER
 	Int parent = m_sleepyUpdates.size() / 2;
   while (true)
 	{
@@ -2697,6 +2732,14 @@ void GameLogic::remakeSleepyUpdate()
 			break;
     --parent;
   }
+#else
+	clearSleepyUpdateWheel();
+	m_sleepyWheelTime = getFrame() << 2;
+	for (std::vector<UpdateModulePtr>::iterator it = m_sleepyUpdates.begin(); it != m_sleepyUpdates.end(); ++it)
+	{
+		linkSleepyUpdate(*it);
+	}
+#endif
 
 	validateSleepyUpdate();
 }
@@ -2711,7 +2754,11 @@ void GameLogic::pushSleepyUpdate(UpdateModulePtr u)
 	m_sleepyUpdates.push_back(u);
 	u->friend_setIndexInLogic(m_sleepyUpdates.size() - 1);
 
+#if RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER
 	rebalanceParentSleepyUpdate(m_sleepyUpdates.size()-1);
+#else
+	linkSleepyUpdate(u);
+#endif
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -2750,6 +2797,141 @@ void GameLogic::popSleepyUpdate()
 	}
 }
 
+#if !RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER
+// ------------------------------------------------------------------------------------------------
+void GameLogic::clearSleepyUpdateWheel()
+{
+	for (Int i = 0; i < SLEEPY_WHEEL_SLOT_COUNT; ++i)
+	{
+		m_sleepyWheel[i].head = nullptr;
+		m_sleepyWheel[i].tail = nullptr;
+	}
+	m_sleepyWheelTime = 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+void GameLogic::linkSleepyUpdate(UpdateModulePtr u)
+{
+	USE_PERF_TIMER(SleepyMaintenance)
+
+	const UnsignedInt pri = u->friend_getPriority();
+	Int slot;
+	if (pri < m_sleepyWheelTime + SLEEPY_WHEEL0_SIZE)
+	{
+		// anything overdue goes into the first slot of the current frame.
+		slot = (pri > m_sleepyWheelTime ? pri : m_sleepyWheelTime) & (SLEEPY_WHEEL0_SIZE - 1);
+	}
+	else if ((pri >> SLEEPY_WHEEL0_BITS) - (m_sleepyWheelTime >> SLEEPY_WHEEL0_BITS) < SLEEPY_WHEEL1_SIZE)
+	{
+		slot = SLEEPY_WHEEL1_FIRST_SLOT + ((pri >> SLEEPY_WHEEL0_BITS) & (SLEEPY_WHEEL1_SIZE - 1));
+	}
+	else
+	{
+		slot = SLEEPY_WHEEL_FAR_SLOT;
+	}
+
+	// append, so that modules with equal priority are updated in the order they were scheduled.
+	SleepyUpdateSlot& s = m_sleepyWheel[slot];
+	u->friend_setSleepySlotLinks(slot, s.tail, nullptr);
+	if (s.tail)
+		s.tail->friend_setNextInSleepySlot(u);
+	else
+		s.head = u;
+	s.tail = u;
+}
+
+// ------------------------------------------------------------------------------------------------
+void GameLogic::unlinkSleepyUpdate(UpdateModulePtr u)
+{
+	USE_PERF_TIMER(SleepyMaintenance)
+
+	const Int slot = u->friend_getSleepySlot();
+	DEBUG_ASSERTCRASH(slot >= 0 && slot < SLEEPY_WHEEL_SLOT_COUNT, ("bad sleepy slot"));
+
+	SleepyUpdateSlot& s = m_sleepyWheel[slot];
+	UpdateModulePtr prev = u->friend_getPrevInSleepySlot();
+	UpdateModulePtr next = u->friend_getNextInSleepySlot();
+	if (prev)
+		prev->friend_setNextInSleepySlot(next);
+	else
+		s.head = next;
+	if (next)
+		next->friend_setPrevInSleepySlot(prev);
+	else
+		s.tail = prev;
+
+	u->friend_setSleepySlotLinks(-1, nullptr, nullptr);
+}
+
+// ------------------------------------------------------------------------------------------------
+void GameLogic::relinkSleepyUpdateSlot(Int slot)
+{
+	// detach the whole slot first, so that modules that go back into the same slot are not visited twice.
+	UpdateModulePtr u = m_sleepyWheel[slot].head;
+	m_sleepyWheel[slot].head = nullptr;
+	m_sleepyWheel[slot].tail = nullptr;
+
+	while (u)
+	{
+		UpdateModulePtr next = u->friend_getNextInSleepySlot();
+		linkSleepyUpdate(u);
+		u = next;
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+void GameLogic::rescheduleSleepyUpdate(UpdateModulePtr u, UnsignedInt frame)
+{
+	unlinkSleepyUpdate(u);
+	u->friend_setNextCallFrame(frame);
+	linkSleepyUpdate(u);
+}
+
+// ------------------------------------------------------------------------------------------------
+void GameLogic::advanceSleepyUpdateWheel(UnsignedInt frame)
+{
+	USE_PERF_TIMER(SleepyMaintenance)
+
+	const UnsignedInt time = frame << 2;
+	while (m_sleepyWheelTime < time)
+	{
+		const Int prevSlot = m_sleepyWheelTime & (SLEEPY_WHEEL0_SIZE - 1);
+		m_sleepyWheelTime += 4;
+
+		// the slots of the previous frame are normally empty by now. anything left over is overdue,
+		// and must move to the current frame before the slots are reused for future frames.
+		for (Int phase = 0; phase < 4; ++phase)
+		{
+			if (m_sleepyWheel[prevSlot + phase].head)
+				relinkSleepyUpdateSlot(prevSlot + phase);
+		}
+
+		// entering a new block of the first level: cascade the matching second level slot,
+		// and every full turn of the second level, take another look at the far slot.
+		if ((m_sleepyWheelTime & (SLEEPY_WHEEL0_SIZE - 1)) == 0)
+		{
+			const UnsignedInt block = m_sleepyWheelTime >> SLEEPY_WHEEL0_BITS;
+			relinkSleepyUpdateSlot(SLEEPY_WHEEL1_FIRST_SLOT + (block & (SLEEPY_WHEEL1_SIZE - 1)));
+			if ((block & (SLEEPY_WHEEL1_SIZE - 1)) == 0)
+				relinkSleepyUpdateSlot(SLEEPY_WHEEL_FAR_SLOT);
+		}
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+UpdateModulePtr GameLogic::peekDueSleepyUpdate() const
+{
+	// only the slots of the current frame can hold modules that are due.
+	const Int slot = m_sleepyWheelTime & (SLEEPY_WHEEL0_SIZE - 1);
+	for (Int phase = 0; phase < 4; ++phase)
+	{
+		if (m_sleepyWheel[slot + phase].head)
+			return m_sleepyWheel[slot + phase].head;
+	}
+	return nullptr;
+}
+#endif
+
 // ------------------------------------------------------------------------------------------------
 // this should be called only by UpdateModule, thanks.
 // ------------------------------------------------------------------------------------------------
@@ -2794,11 +2976,16 @@ void GameLogic::friend_awakenUpdateModule(Object* obj, UpdateModulePtr u, Unsign
 			return;
 		}
 
+#if RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER
 		// update the value.
 		u->friend_setNextCallFrame(whenToWakeUp);
 
 		// rebalance.
 		rebalanceSleepyUpdate(idx);
+#else
+		// move it to the slot of the new wake frame.
+		rescheduleSleepyUpdate(u, whenToWakeUp);
+#endif
 
 		// validate. (harmless except in debug mode)
 		validateSleepyUpdate();
@@ -3284,8 +3471,12 @@ void GameLogic::update()
 #endif
 
 	{
+#if !RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER
+		advanceSleepyUpdateWheel(now);
+#endif
 		while (!m_sleepyUpdates.empty())
 		{
+#if RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER
 			UpdateModulePtr u = peekSleepyUpdate();
 
 			if (!u)
@@ -3300,6 +3491,14 @@ void GameLogic::update()
 			{
 				break;
 			}
+#else
+			// we're done, everyone else is sleeping.
+			UpdateModulePtr u = peekDueSleepyUpdate();
+			if (!u)
+			{
+				break;
+			}
+#endif
 
 			UpdateSleepTime sleepLen = UPDATE_SLEEP_NONE;	// default, if it is disabled.
 
@@ -3329,8 +3528,12 @@ void GameLogic::update()
 			}
 
 			// else defer it till next frame and re-push it
+#if RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER
 			u->friend_setNextCallFrame(now + sleepLen);
 			rebalanceSleepyUpdate(0);
+#else
+			rescheduleSleepyUpdate(u, now + sleepLen);
+#endif
 		}
 	}
 
@@ -3376,6 +3579,9 @@ void GameLogic::update()
 		}
 	}
 
+	// send the net shroud changes of this frame to the display and the radar
+	ThePartitionManager->processQueuedClientShroudUpdates();
+
 	// increment world time
 	if (!m_startNewGame)
 	{
@@ -4790,8 +4996,14 @@ void GameLogic::loadPostProcess()
 	for (std::vector<UpdateModulePtr>::iterator it = m_sleepyUpdates.begin(); it != m_sleepyUpdates.end(); ++it)
 	{
 		(*it)->friend_setIndexInLogic(-1);
+#if !RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER
+		(*it)->friend_setSleepySlotLinks(-1, nullptr, nullptr);
+#endif
 	}
 	m_sleepyUpdates.clear();
+#if !RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER
+	clearSleepyUpdateWheel();
+#endif
 #ifdef ALLOW_NONSLEEPY_UPDATES
 	m_normalUpdates.clear();
 #else
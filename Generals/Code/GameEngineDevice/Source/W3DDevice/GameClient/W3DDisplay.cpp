@@ -42,6 +42,7 @@ static void drawFramerateBar();
 
 // USER INCLUDES //////////////////////////////////////////////////////////////
 #include "Common/FramePacer.h"
+#include "Common/GameEngine.h"
 #include "Common/ThingFactory.h"
 #include "Common/GlobalData.h"
 #include "Common/PerfTimer.h"
@@ -248,6 +249,10 @@ void StatDumpClass::dumpStats()
 	Int totalParticles = TheParticleSystemManager->getParticleCount();
 	Int onScreenParticleCount = TheParticleSystemManager->getOnScreenParticleCount();
 	fprintf( m_fp, "  Particles: %d in world (%d onscreen)\n", totalParticles, onScreenParticleCount );
+	fprintf( m_fp, "  Particle update time last frame: %.5f msec (%d worker threads)\n",
+		TheParticleSystemManager->getUpdateTimeLastFrame()*1000, TheParticleSystemManager->getUpdateThreadCount() );
+	fprintf( m_fp, "  Client update time last frame: %.5f msec, logic update time last frame: %.5f msec\n",
+		TheGameEngine->getClientUpdateTimeLastFrame()*1000, TheGameEngine->getLogicUpdateTimeLastFrame()*1000 );
 
 	// polygons this frame
 	Int polyPerFrame = Debug_Statistics::Get_DX8_Polygons();
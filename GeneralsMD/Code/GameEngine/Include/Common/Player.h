@@ -736,6 +736,24 @@ protected:
 
 	void deleteUpgradeList();															///< delete all our upgrades
 
+private:
+
+	// Ronin @performance 16/10/2026 The members of all teams in m_playerTeamPrototypes are indexed by template and by
+	// KindOf bit, so the object queries above no longer walk every team. The index is kept up to date by
+	// becomingTeamMember, addTeamToList and removeTeamFromList.
+	typedef std::vector<Object*> IndexedObjectVec;
+	struct IndexedTemplateObjects
+	{
+		const ThingTemplate*	m_template;
+		IndexedObjectVec			m_objects;
+	};
+	typedef std::vector<IndexedTemplateObjects> IndexedTemplateObjectsVec;
+
+	void addToObjectIndex(Object *obj);
+	void removeFromObjectIndex(Object *obj);
+	void updateObjectIndexForTeam(TeamPrototype *team, Bool add);
+	const IndexedObjectVec& getIndexedObjectsOfKind(const KindOfMaskType& setMask) const;	///< smallest list that holds every object with all of setMask
+
 private:
 
 	const PlayerTemplate*				m_playerTemplate;			///< Pointer back to the Player Template
@@ -784,6 +802,9 @@ private:
 	UnicodeString					m_generalName;		///< (SAVE) This is the name of the general the player is allowed to change.
 
 	PlayerTeamList				m_playerTeamPrototypes;				///< ALL the teams we control, via prototype
+	IndexedObjectVec			m_indexedObjects;							///< (NO-SAVE) all members of the teams we control
+	IndexedObjectVec			m_indexedObjectsByKindOf[KINDOF_COUNT];	///< (NO-SAVE) members of the teams we control, by each KindOf bit of their template
+	IndexedTemplateObjectsVec	m_indexedObjectsByTemplate;	///< (NO-SAVE) members of the teams we control, by template
 	PlayerRelationMap			*m_playerRelations;						///< allies & enemies
 	TeamRelationMap				*m_teamRelations;							///< allies & enemies
 
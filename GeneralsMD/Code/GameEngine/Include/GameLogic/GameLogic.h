@@ -293,6 +293,15 @@ private:
 	Int rebalanceChildSleepyUpdate(Int i);
 	void remakeSleepyUpdate();
 	void validateSleepyUpdate() const;
+#if !RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER
+	void clearSleepyUpdateWheel();
+	void linkSleepyUpdate(UpdateModulePtr u);
+	void unlinkSleepyUpdate(UpdateModulePtr u);
+	void relinkSleepyUpdateSlot(Int slot);
+	void rescheduleSleepyUpdate(UpdateModulePtr u, UnsignedInt frame);
+	void advanceSleepyUpdateWheel(UnsignedInt frame);
+	UpdateModulePtr peekDueSleepyUpdate() const;
+#endif
 
 	static void createOptimizedTree(const ThingTemplate *thingTemplate, Coord3D *pos, Real angle);
 
@@ -350,6 +359,31 @@ private:
 	// http://dogma.net/markn/articles/pq_stl/priority.htm)
 	std::vector<UpdateModulePtr> m_sleepyUpdates;
 
+#if !RETAIL_COMPATIBLE_SLEEPY_UPDATE_ORDER
+	// Ronin @performance 16/10/2026
+	// Hierarchical timing wheel that schedules the sleepy updates instead of the heap order of m_sleepyUpdates,
+	// which then is just the list of all scheduled modules. Slots are keyed on the update priority (frame and phase).
+	// The first level has a slot per priority for the next 256 frames, the second level has a slot per 256 frames
+	// for the next ~36 minutes, and everything beyond goes into a single far slot. Slots are cascaded down when the
+	// wheel time reaches them. Modules in a slot are updated in the order they were scheduled.
+	enum
+	{
+		SLEEPY_WHEEL0_BITS = 10,
+		SLEEPY_WHEEL0_SIZE = 1 << SLEEPY_WHEEL0_BITS,
+		SLEEPY_WHEEL1_SIZE = 256,
+		SLEEPY_WHEEL1_FIRST_SLOT = SLEEPY_WHEEL0_SIZE,
+		SLEEPY_WHEEL_FAR_SLOT = SLEEPY_WHEEL1_FIRST_SLOT + SLEEPY_WHEEL1_SIZE,
+		SLEEPY_WHEEL_SLOT_COUNT
+	};
+	struct SleepyUpdateSlot
+	{
+		UpdateModulePtr head;
+		UpdateModulePtr tail;
+	};
+	SleepyUpdateSlot m_sleepyWheel[SLEEPY_WHEEL_SLOT_COUNT];
+	UnsignedInt m_sleepyWheelTime;													///< Priority of phase 0 of the current frame. Nothing is scheduled before it.
+#endif
+
 #ifdef ALLOW_NONSLEEPY_UPDATES
 	// this is a plain old list, not a pq.
 	std::list<UpdateModulePtr> m_normalUpdates;
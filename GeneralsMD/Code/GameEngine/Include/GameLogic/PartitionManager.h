@@ -303,6 +303,10 @@ private:
 	Short													m_coiCount;					///< number of COIs in this cell.
 	Short													m_cellX;						///< x-coord of this cell within the Partition Mgr coords (NOT in world coords)
 	Short													m_cellY;						///< y-coord of this cell within the Partition Mgr coords (NOT in world coords)
+	Bool													m_isQueuedForClientShroud;	///< true while the cell waits in the client shroud update queue
+	CellShroudStatus							m_clientShroudBeforeQueue;	///< local player shroud status the client showed when the cell was queued
+
+	void queueClientShroudUpdate( CellShroudStatus oldShroud );
 
 public:
 
@@ -359,6 +363,10 @@ public:
 
 	// intended only for CellAndObjectIntersection.
 	void friend_removeFromCellList(CellAndObjectIntersection *coi);
+
+	// intended only for PartitionManager.
+	CellShroudStatus friend_dequeueClientShroudUpdate();
+	void friend_clearClientShroudUpdate() { m_isQueuedForClientShroud = FALSE; }
 };
 
 //=====================================
@@ -1252,6 +1260,7 @@ private:
 	Bool						m_updatedSinceLastReset;	///< Used to force a return of OBJECTSHROUD_INVALID before update has been called.
 
 	std::queue<SightingInfo *> m_pendingUndoShroudReveals;	///< Anything can queue up an Undo to happen later. This is a queue, because "later" is a constant
+	std::vector<PartitionCell *> m_queuedClientShroudCells;	///< Cells whose local player shroud status changed since the last client shroud update
 
 #ifdef FASTER_GCO
 	Int							m_maxGcoRadius;
@@ -1309,6 +1318,7 @@ protected:
 
 	void processPendingUndoShroudRevealQueue(Bool considerTimestamp = TRUE);				///< keep popping and processing until you get to one that is in the future
 	void resetPendingUndoShroudRevealQueue();					///< Just delete everything in the queue without doing anything with them
+	void resetQueuedClientShroudUpdates();						///< Forget the queued client shroud updates without sending them
 
 public:
 
@@ -1515,6 +1525,13 @@ public:
 		*/
 	void refreshShroudForLocalPlayer();
 
+	/** send the net shroud changes of the local player since the last call to the display and the radar.
+		Cells that were revealed and covered again in the meantime are skipped.
+		*/
+	void processQueuedClientShroudUpdates();
+
+	void friend_queueClientShroudUpdate( PartitionCell *cell ) { m_queuedClientShroudCells.push_back(cell); } ///< intended only for PartitionCell
+
 	/**
 		Shrouded has no absolute meaning.  It only makes sense to say "Shrouded for him".
 	*/
@@ -88,9 +88,20 @@ protected:
 	static PolygonTrigger* ThePolygonTriggerListPtr;
 	static Int s_currentID; ///< Current id for new triggers.
 
+	// Ronin @performance 16/10/2026 Uniform grid over the trigger bounds so point queries only test nearby triggers.
+	static Bool s_indexNeedsUpdate;	///< Set whenever the list or the 2D shape of a trigger changes.
+	static ICoord2D s_indexOrigin;	///< World position of the lower corner of cell 0.
+	static Int s_indexCellSize;
+	static Int s_indexCellsX;
+	static Int s_indexCellsY;
+	static Int *s_indexCellStart;	///< Offset of each cell in s_indexCellTriggers, one extra entry at the end.
+	static PolygonTrigger **s_indexCellTriggers;	///< Triggers per cell, in list order.
+
 protected:
 	void reallocate();
 	void updateBounds() const;
+	static void updateIndex();
+	static void freeIndex();
 
 	// snapshot methods
 	virtual void crc( Xfer *xfer ) override;
@@ -108,11 +119,13 @@ public:
 	/// Writes Triggers Info
 	static void WritePolygonTriggersDataChunk(DataChunkOutput &chunkWriter);
 	static void deleteTriggers();
+	/// Gets the triggers whose bounds may contain the point, in list order. Valid until the trigger list changes.
+	static Int getPolygonTriggerCandidates(const ICoord3D &point, PolygonTrigger * const *&candidates);
 
 public:
 	static void addPolygonTrigger(PolygonTrigger *pTrigger);
 	static void removePolygonTrigger(PolygonTrigger *pTrigger);
-	void setNextPoly(PolygonTrigger *nextPoly) {m_nextPolygonTrigger = nextPoly;} ///< Link the next map object.
+	void setNextPoly(PolygonTrigger *nextPoly) {m_nextPolygonTrigger = nextPoly; s_indexNeedsUpdate = true;} ///< Link the next map object.
 	void addPoint(const ICoord3D &point);
 	void setPoint(const ICoord3D &point, Int ndx);
 	void insertPoint(const ICoord3D &point, Int ndx);
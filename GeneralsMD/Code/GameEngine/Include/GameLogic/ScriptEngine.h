@@ -231,6 +231,12 @@ public:
 	void removeSequentialScript(SequentialScript *scriptToRemove);
 	void notifyOfTeamDestruction(Team *teamDestroyed);
 	void notifyOfObjectCreationOrDestruction();
+
+	// Ronin @performance 16/10/2026 Scripts whose conditions only read counters, flags or named units
+	// reuse their last condition result until that state changes.
+	void notifyOfScriptStateChange(ScriptStateType state) { ++m_scriptStateVersions[state]; }
+	void setConditionDependencyTracking(Bool enable) { m_conditionDependencyTracking = enable; }
+	Bool getConditionDependencyTracking() const { return m_conditionDependencyTracking; }
 	UnsignedInt getFrameObjectCountChanged() {return m_frameObjectCountChanged;}
 	void setSequentialTimer(Object *obj, Int frameCount);
 	void setSequentialTimer(Team *team, Int frameCount);
@@ -391,6 +397,8 @@ protected:
 	void disableScript( ScriptAction *pAction );
 	void callSubroutine( ScriptAction *pAction );
 	void checkConditionsForTeamNames(Script *pScript);
+	void checkConditionDependencies(Script *pScript);
+	void invalidateScriptStateVersions();
 	Bool evaluateCounter( Condition *pCondition );
 	Bool evaluateFlag( Condition *pCondition );
 	Bool evaluateTimer( Condition *pCondition );
@@ -409,6 +417,12 @@ protected:
 
 	AttackPriorityInfo *findAttackInfo(const AsciiString& name, Bool addIfNotFound);
 
+	// Ronin @performance 16/10/2026 Named object lookups go through m_namedObjectIndex instead of scanning m_namedObjects.
+	void clearNamedObjects();
+	void addNamedObject(const AsciiString& name, Object* obj);
+	void renameNamedObject(Int index, const AsciiString& name);
+	Int findNamedObject(const AsciiString& name) const; ///< Returns the index of the first entry with that name, or -1
+
 protected:
 	/// Stuff to execute scripts sequentially
 	typedef std::vector<SequentialScript*> VecSequentialScriptPtr;
@@ -441,6 +455,8 @@ protected:
 	Team							*m_conditionTeam;				///< Team that is being used to evaluate conditions, used for THIS_TEAM
 	Object						*m_conditionObject;				///< Unit that is being used to evaluate conditions, used for THIS_OBJECT
 	VecNamedRequests	m_namedObjects;
+	typedef std::hash_map<AsciiString, Int, rts::hash<AsciiString>, rts::equal_to<AsciiString> > NamedObjectIndexMap;
+	NamedObjectIndexMap m_namedObjectIndex;	///< Index of the first entry in m_namedObjects of each name
 	Bool							m_firstUpdate;
 	Player						*m_currentPlayer;
 	Player						*m_skirmishHumanPlayer;
@@ -457,6 +473,9 @@ protected:
 
 	UnsignedInt				m_frameObjectCountChanged;
 
+	UnsignedInt				m_scriptStateVersions[SCRIPT_STATE_COUNT];	///< Bumped whenever the state changes, see ScriptStateType
+	Bool							m_conditionDependencyTracking;
+
 	ObjectTypeCount		m_objectCounts[MAX_PLAYER_COUNT];
 
 	/// These are three separate lists rather than one to increase speed efficiency
@@ -844,6 +844,7 @@ GlobalData::GlobalData()
 	m_drawEntireTerrain = FALSE;
 	m_maxParticleCount = 0;
 	m_maxFieldParticleCount = 30;
+	m_particleUpdateThreads = 0;
 
 	m_debugAI = AI_DEBUG_NONE;
 	m_debugSupplyCenterPlacement = FALSE;
@@ -1004,6 +1005,11 @@ GlobalData::GlobalData()
 
 	m_simulateReplays.clear();
 	m_simulateReplayJobs = SIMULATE_REPLAYS_SEQUENTIAL;
+	m_simulateReplaysPerJob = 1;
+	m_simulateReplayWorker = FALSE;
+	m_simulateReplayReport.clear();
+	m_simulateReplaySeekFrame = -1;
+	m_replaySnapshotInterval = 0;
 
 	for (i = LEVEL_FIRST; i <= LEVEL_LAST; ++i)
 		m_healthBonus[i] = 1.0f;
@@ -1020,6 +1020,11 @@ void Player::becomingTeamMember(Object *obj, Bool yes)
 	if (!obj)
 		return;
 
+	if (yes)
+		addToObjectIndex(obj);
+	else
+		removeFromObjectIndex(obj);
+
 	// energy production/consumption hooks, note we ignore things that are UNDER_CONSTRUCTION
 	if( !obj->getStatusBits().test( OBJECT_STATUS_UNDER_CONSTRUCTION ) )
 	{
@@ -1732,6 +1737,7 @@ void Player::addTeamToList(TeamPrototype* team)
 	}
 
 	m_playerTeamPrototypes.push_back(team);
+	updateObjectIndexForTeam(team, true);
 }
 
 //=============================================================================
@@ -1743,11 +1749,106 @@ void Player::removeTeamFromList(TeamPrototype* team)
 		if (team == *it)
 		{
 			m_playerTeamPrototypes.erase(it);
+			updateObjectIndexForTeam(team, false);
+			return;
+		}
+	}
+}
+
+//=============================================================================
+static void removeFromIndexedObjectVec(std::vector<Object*>& objects, Object *obj)
+{
+	std::vector<Object*>::iterator it = std::find(objects.begin(), objects.end(), obj);
+	DEBUG_ASSERTCRASH(it != objects.end(), ("Object '%s' is missing from the player object index", obj->getTemplate()->getName().str()));
+	if (it == objects.end())
+		return;
+
+	// order does not matter, so swap with the last entry
+	*it = objects.back();
+	objects.pop_back();
+}
+
+//=============================================================================
+void Player::addToObjectIndex(Object *obj)
+{
+	const ThingTemplate *tmpl = obj->getTemplate();
+
+	m_indexedObjects.push_back(obj);
+
+	for (Int i = KINDOF_FIRST; i < KINDOF_COUNT; ++i)
+	{
+		if (tmpl->isKindOf((KindOfType)i))
+			m_indexedObjectsByKindOf[i].push_back(obj);
+	}
+
+	for (IndexedTemplateObjectsVec::iterator it = m_indexedObjectsByTemplate.begin(); it != m_indexedObjectsByTemplate.end(); ++it)
+	{
+		if (it->m_template == tmpl)
+		{
+			it->m_objects.push_back(obj);
+			return;
+		}
+	}
+
+	IndexedTemplateObjects entry;
+	entry.m_template = tmpl;
+	entry.m_objects.push_back(obj);
+	m_indexedObjectsByTemplate.push_back(entry);
+}
+
+//=============================================================================
+void Player::removeFromObjectIndex(Object *obj)
+{
+	const ThingTemplate *tmpl = obj->getTemplate();
+
+	removeFromIndexedObjectVec(m_indexedObjects, obj);
+
+	for (Int i = KINDOF_FIRST; i < KINDOF_COUNT; ++i)
+	{
+		if (tmpl->isKindOf((KindOfType)i))
+			removeFromIndexedObjectVec(m_indexedObjectsByKindOf[i], obj);
+	}
+
+	for (IndexedTemplateObjectsVec::iterator it = m_indexedObjectsByTemplate.begin(); it != m_indexedObjectsByTemplate.end(); ++it)
+	{
+		if (it->m_template == tmpl)
+		{
+			removeFromIndexedObjectVec(it->m_objects, obj);
+			if (it->m_objects.empty())
+				m_indexedObjectsByTemplate.erase(it);
 			return;
 		}
 	}
 }
 
+//=============================================================================
+/** A team prototype changed hands as a whole (see Team::setControllingPlayer), so all members of all of its teams move too. */
+void Player::updateObjectIndexForTeam(TeamPrototype *team, Bool add)
+{
+	for (DLINK_ITERATOR<Team> iter = team->iterate_TeamInstanceList(); !iter.done(); iter.advance())
+	{
+		for (DLINK_ITERATOR<Object> objIter = iter.cur()->iterate_TeamMemberList(); !objIter.done(); objIter.advance())
+		{
+			if (add)
+				addToObjectIndex(objIter.cur());
+			else
+				removeFromObjectIndex(objIter.cur());
+		}
+	}
+}
+
+//=============================================================================
+const Player::IndexedObjectVec& Player::getIndexedObjectsOfKind(const KindOfMaskType& setMask) const
+{
+	const IndexedObjectVec *best = &m_indexedObjects;
+	for (Int i = KINDOF_FIRST; i < KINDOF_COUNT; ++i)
+	{
+		if (setMask.test(i) && m_indexedObjectsByKindOf[i].size() < best->size())
+			best = &m_indexedObjectsByKindOf[i];
+	}
+	return *best;
+}
+
 //=============================================================================
 void Player::healAllObjects()
 {
@@ -1776,24 +1877,59 @@ void Player::countObjectsByThingTemplate(Int numTmplates, const ThingTemplate* c
 	for (i = 0; i < numTmplates; ++i)
 		counts[i] = 0;
 
+	for (IndexedTemplateObjectsVec::const_iterator it = m_indexedObjectsByTemplate.begin();
+			 it != m_indexedObjectsByTemplate.end(); ++it)
+	{
+		// an object only counts towards the first template it is equivalent to, same as Team::countObjectsByThingTemplate
+		for (i = 0; i < numTmplates; ++i)
+		{
+			if (it->m_template->isEquivalentTo(things[i]))
+				break;
+		}
+
+		if (i == numTmplates)
+			continue;
+
+		for (IndexedObjectVec::const_iterator objIt = it->m_objects.begin(); objIt != it->m_objects.end(); ++objIt)
+		{
+			const Object *obj = *objIt;
+
+			if (ignoreDead && obj->isEffectivelyDead())
+				continue;
+
+			if (ignoreUnderConstruction && obj->getStatusBits().test(OBJECT_STATUS_UNDER_CONSTRUCTION))
+				continue;
+
+			counts[i] += 1;
+		}
+	}
+
+#if VALIDATE_PLAYER_OBJECT_INDEX
+	std::vector<Int> walkCounts(numTmplates + 1, 0);
 	for (PlayerTeamList::const_iterator it = m_playerTeamPrototypes.begin();
-			 it != m_playerTeamPrototypes.end();
-			 ++it)
+			 it != m_playerTeamPrototypes.end(); ++it)
 	{
-		(*it)->countObjectsByThingTemplate(numTmplates, things, ignoreDead, counts, ignoreUnderConstruction);
+		(*it)->countObjectsByThingTemplate(numTmplates, things, ignoreDead, &walkCounts[0], ignoreUnderConstruction);
 	}
+	for (i = 0; i < numTmplates; ++i)
+		DEBUG_ASSERTCRASH(counts[i] == walkCounts[i], ("Player object index count for '%s' is %d, but the teams have %d", things[i] ? things[i]->getName().str() : "null", counts[i], walkCounts[i]));
+#endif
 }
 
 //=============================================================================
 Int Player::countBuildings()
 {
-	int retVal = 0;
+	int retVal = (Int)m_indexedObjectsByKindOf[KINDOF_STRUCTURE].size();
 
+#if VALIDATE_PLAYER_OBJECT_INDEX
+	int walkRetVal = 0;
 	for (PlayerTeamList::const_iterator it = m_playerTeamPrototypes.begin();
 			 it != m_playerTeamPrototypes.end(); ++it)
 	{
-		retVal += (*it)->countBuildings();
+		walkRetVal += (*it)->countBuildings();
 	}
+	DEBUG_ASSERTCRASH(retVal == walkRetVal, ("Player object index has %d buildings, but the teams have %d", retVal, walkRetVal));
+#endif
 	return retVal;
 }
 
@@ -1802,11 +1938,22 @@ Int Player::countObjects(KindOfMaskType setMask, KindOfMaskType clearMask)
 {
 	int retVal = 0;
 
+	const IndexedObjectVec& candidates = getIndexedObjectsOfKind(setMask);
+	for (IndexedObjectVec::const_iterator it = candidates.begin(); it != candidates.end(); ++it)
+	{
+		if ((*it)->isKindOfMulti(setMask, clearMask))
+			++retVal;
+	}
+
+#if VALIDATE_PLAYER_OBJECT_INDEX
+	int walkRetVal = 0;
 	for (PlayerTeamList::const_iterator it = m_playerTeamPrototypes.begin();
 			 it != m_playerTeamPrototypes.end(); ++it)
 	{
-		retVal += (*it)->countObjects(setMask, clearMask);
+		walkRetVal += (*it)->countObjects(setMask, clearMask);
 	}
+	DEBUG_ASSERTCRASH(retVal == walkRetVal, ("Player object index has %d matching objects, but the teams have %d", retVal, walkRetVal));
+#endif
 	return retVal;
 }
 
@@ -1821,62 +1968,169 @@ Object *Player::findClosestByKindOf( Object *queryObject, KindOfMaskType setMask
 	data.m_clearKindOf = clearMask;
 	data.m_source = queryObject;
 
+	Bool isTied = FALSE;
+	const IndexedObjectVec& candidates = getIndexedObjectsOfKind(setMask);
+	for (IndexedObjectVec::const_iterator it = candidates.begin(); it != candidates.end(); ++it)
+	{
+		Object *obj = *it;
+		if( !obj->isKindOfMulti( setMask, clearMask ) )
+			continue;
+
+		Real distSq = ThePartitionManager->getDistanceSquared( queryObject, obj, FROM_CENTER_2D );
+		if( distSq < data.m_closestDistSq )
+		{
+			data.m_closest = obj;
+			data.m_closestDistSq = distSq;
+			isTied = FALSE;
+		}
+		else if( distSq == data.m_closestDistSq && data.m_closest != nullptr )
+		{
+			isTied = TRUE;
+		}
+	}
+
+#if !VALIDATE_PLAYER_OBJECT_INDEX
+	// A unique closest object is the same one the team walk finds. Ties are won by whichever object comes first
+	// in team order, which the index does not keep, so those still go through the teams.
+	if( !isTied )
+		return data.m_closest;
+#endif
+
+	Object *indexClosest = isTied ? nullptr : data.m_closest;
+	data.m_closest = nullptr;
+	data.m_closestDistSq = FLT_MAX;
+
 	// Magic presto!  data ends up with the answer in it!
 	iterateObjects( findClosestKindOf, &data );
 
+	DEBUG_ASSERTCRASH(isTied || indexClosest == data.m_closest, ("Player object index found a different closest object than the teams"));
+	(void)indexClosest;
+
 	return data.m_closest;
 }
 
 //=============================================================================
 Bool Player::hasAnyBuildings() const
 {
+	Bool retVal = false;
+
+	const IndexedObjectVec& buildings = m_indexedObjectsByKindOf[KINDOF_STRUCTURE];
+	for (IndexedObjectVec::const_iterator it = buildings.begin(); it != buildings.end(); ++it)
+	{
+		if ((*it)->isEffectivelyDead() || (*it)->isDestroyed())
+			continue;
+
+		retVal = true;
+		break;
+	}
+
+#if VALIDATE_PLAYER_OBJECT_INDEX
+	Bool walkRetVal = false;
 	for (PlayerTeamList::const_iterator it = m_playerTeamPrototypes.begin();
-			 it != m_playerTeamPrototypes.end(); ++it)
+			 it != m_playerTeamPrototypes.end() && !walkRetVal; ++it)
 	{
-		if ((*it)->hasAnyBuildings()) {
-			return true;
-		}
+		walkRetVal = (*it)->hasAnyBuildings();
 	}
-	return false;
+	DEBUG_ASSERTCRASH(retVal == walkRetVal, ("Player object index disagrees with the teams about having buildings"));
+#endif
+	return retVal;
 }
 
 //=============================================================================
 Bool Player::hasAnyBuildings(KindOfMaskType kindOf) const
 {
-	for (PlayerTeamList::const_iterator it = m_playerTeamPrototypes.begin();
-			 it != m_playerTeamPrototypes.end(); ++it)
+	Bool retVal = false;
+
+	KindOfMaskType setMask = kindOf;
+	setMask.set(KINDOF_STRUCTURE);
+
+	const IndexedObjectVec& candidates = getIndexedObjectsOfKind(setMask);
+	for (IndexedObjectVec::const_iterator it = candidates.begin(); it != candidates.end(); ++it)
 	{
-		if ((*it)->hasAnyBuildings(kindOf)) {
-			return true;
+		if ((*it)->isEffectivelyDead() || (*it)->isDestroyed())
+			continue;
+
+		if ((*it)->isKindOfMulti(setMask, KINDOFMASK_NONE))
+		{
+			retVal = true;
+			break;
 		}
 	}
-	return false;
+
+#if VALIDATE_PLAYER_OBJECT_INDEX
+	Bool walkRetVal = false;
+	for (PlayerTeamList::const_iterator it = m_playerTeamPrototypes.begin();
+			 it != m_playerTeamPrototypes.end() && !walkRetVal; ++it)
+	{
+		walkRetVal = (*it)->hasAnyBuildings(kindOf);
+	}
+	DEBUG_ASSERTCRASH(retVal == walkRetVal, ("Player object index disagrees with the teams about having buildings of a kind"));
+#endif
+	return retVal;
 }
 
 //=============================================================================
 Bool Player::hasAnyUnits() const
 {
+	Bool retVal = false;
+
+	for (IndexedObjectVec::const_iterator it = m_indexedObjects.begin(); it != m_indexedObjects.end(); ++it)
+	{
+		const Object *obj = *it;
+
+		if (obj->isEffectivelyDead() || obj->isDestroyed())
+			continue;
+
+		// Structures, projectiles and mines are not units.
+		if (obj->isKindOf(KINDOF_STRUCTURE) || obj->isKindOf(KINDOF_PROJECTILE) || obj->isKindOf(KINDOF_MINE))
+			continue;
+
+		retVal = true;
+		break;
+	}
+
+#if VALIDATE_PLAYER_OBJECT_INDEX
+	Bool walkRetVal = false;
 	for (PlayerTeamList::const_iterator it = m_playerTeamPrototypes.begin();
-			 it != m_playerTeamPrototypes.end(); ++it)
+			 it != m_playerTeamPrototypes.end() && !walkRetVal; ++it)
 	{
-		if ((*it)->hasAnyUnits()) {
-			return true;
-		}
+		walkRetVal = (*it)->hasAnyUnits();
 	}
-	return false;
+	DEBUG_ASSERTCRASH(retVal == walkRetVal, ("Player object index disagrees with the teams about having units"));
+#endif
+	return retVal;
 }
 
 //=============================================================================
 Bool Player::hasAnyObjects() const
 {
+	Bool retVal = false;
+
+	for (IndexedObjectVec::const_iterator it = m_indexedObjects.begin(); it != m_indexedObjects.end(); ++it)
+	{
+		const Object *obj = *it;
+
+		if (obj->isEffectivelyDead() || obj->isDestroyed())
+			continue;
+
+		// Projectiles, inert things like radiation fields and mines don't count.
+		if (obj->isKindOf(KINDOF_PROJECTILE) || obj->isKindOf(KINDOF_INERT) || obj->isKindOf(KINDOF_MINE))
+			continue;
+
+		retVal = true;
+		break;
+	}
+
+#if VALIDATE_PLAYER_OBJECT_INDEX
+	Bool walkRetVal = false;
 	for (PlayerTeamList::const_iterator it = m_playerTeamPrototypes.begin();
-			 it != m_playerTeamPrototypes.end(); ++it)
+			 it != m_playerTeamPrototypes.end() && !walkRetVal; ++it)
 	{
-		if ((*it)->hasAnyObjects()) {
-			return true;
-		}
+		walkRetVal = (*it)->hasAnyObjects();
 	}
-	return false;
+	DEBUG_ASSERTCRASH(retVal == walkRetVal, ("Player object index disagrees with the teams about having objects"));
+#endif
+	return retVal;
 }
 
 //=============================================================================
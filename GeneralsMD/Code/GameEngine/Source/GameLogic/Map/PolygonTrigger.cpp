@@ -38,6 +38,13 @@
 /* ********* PolygonTrigger class ****************************/
 PolygonTrigger *PolygonTrigger::ThePolygonTriggerListPtr = nullptr;
 Int PolygonTrigger::s_currentID = 1;
+Bool PolygonTrigger::s_indexNeedsUpdate = true;
+ICoord2D PolygonTrigger::s_indexOrigin;
+Int PolygonTrigger::s_indexCellSize = 1;
+Int PolygonTrigger::s_indexCellsX = 0;
+Int PolygonTrigger::s_indexCellsY = 0;
+Int *PolygonTrigger::s_indexCellStart = nullptr;
+PolygonTrigger **PolygonTrigger::s_indexCellTriggers = nullptr;
 /**
  PolygonTrigger - Constructor.
 */
@@ -226,6 +233,7 @@ Bool PolygonTrigger::ParsePolygonTriggersDataChunk(DataChunkInput &file, DataChu
 		pPrevTrig = pTrig;
 	}
 	s_currentID = maxTriggerId+1;
+	updateIndex();
 	DEBUG_ASSERTCRASH(file.atEndOfChunk(), ("Incorrect data file length."));
 	return true;
 }
@@ -289,6 +297,125 @@ void PolygonTrigger::updateBounds()	const
 	m_radius = sqrt(halfHeight*halfHeight + halfWidth*halfWidth);
 }
 
+/**
+ PolygonTrigger::updateIndex - Rebuilds the grid of trigger bounds used by getPolygonTriggerCandidates.
+*/
+void PolygonTrigger::updateIndex()
+{
+	const Int MAX_INDEX_CELLS = 64; // per axis.
+	freeIndex();
+	s_indexNeedsUpdate = false;
+
+	IRegion2D extent;
+	Int numTriggers = 0;
+	PolygonTrigger *pTrig;
+	for (pTrig=getFirstPolygonTrigger(); pTrig; pTrig = pTrig->getNext()) {
+		if (pTrig->m_numPoints == 0) continue; // never contains a point.
+		if (pTrig->m_boundsNeedsUpdate) {
+			pTrig->updateBounds();
+		}
+		if (numTriggers == 0) {
+			extent = pTrig->m_bounds;
+		} else {
+			if (pTrig->m_bounds.lo.x < extent.lo.x) extent.lo.x = pTrig->m_bounds.lo.x;
+			if (pTrig->m_bounds.lo.y < extent.lo.y) extent.lo.y = pTrig->m_bounds.lo.y;
+			if (pTrig->m_bounds.hi.x > extent.hi.x) extent.hi.x = pTrig->m_bounds.hi.x;
+			if (pTrig->m_bounds.hi.y > extent.hi.y) extent.hi.y = pTrig->m_bounds.hi.y;
+		}
+		numTriggers++;
+	}
+	if (numTriggers == 0) {
+		return;
+	}
+
+	Int width = extent.hi.x - extent.lo.x + 1;
+	Int height = extent.hi.y - extent.lo.y + 1;
+	Int largest = width > height ? width : height;
+	s_indexCellSize = (largest + MAX_INDEX_CELLS - 1) / MAX_INDEX_CELLS;
+	s_indexCellsX = (width + s_indexCellSize - 1) / s_indexCellSize;
+	s_indexCellsY = (height + s_indexCellSize - 1) / s_indexCellSize;
+	s_indexOrigin.x = extent.lo.x;
+	s_indexOrigin.y = extent.lo.y;
+
+	Int numCells = s_indexCellsX * s_indexCellsY;
+	s_indexCellStart = NEW Int[numCells+1];
+	Int *cellFill = NEW Int[numCells];
+	Int i, x, y;
+	for (i=0; i<=numCells; i++) {
+		s_indexCellStart[i] = 0;
+	}
+
+	// First pass counts the triggers in each cell, second pass stores them in list order.
+	for (Int pass=0; pass<2; pass++) {
+		for (pTrig=getFirstPolygonTrigger(); pTrig; pTrig = pTrig->getNext()) {
+			if (pTrig->m_numPoints == 0) continue;
+			Int loX = (pTrig->m_bounds.lo.x - s_indexOrigin.x) / s_indexCellSize;
+			Int loY = (pTrig->m_bounds.lo.y - s_indexOrigin.y) / s_indexCellSize;
+			Int hiX = (pTrig->m_bounds.hi.x - s_indexOrigin.x) / s_indexCellSize;
+			Int hiY = (pTrig->m_bounds.hi.y - s_indexOrigin.y) / s_indexCellSize;
+			for (y=loY; y<=hiY; y++) {
+				for (x=loX; x<=hiX; x++) {
+					Int cell = y*s_indexCellsX + x;
+					if (pass == 0) {
+						s_indexCellStart[cell+1]++;
+					} else {
+						s_indexCellTriggers[cellFill[cell]++] = pTrig;
+					}
+				}
+			}
+		}
+		if (pass == 0) {
+			for (i=0; i<numCells; i++) {
+				s_indexCellStart[i+1] += s_indexCellStart[i];
+				cellFill[i] = s_indexCellStart[i];
+			}
+			s_indexCellTriggers = NEW PolygonTrigger*[s_indexCellStart[numCells]];
+		}
+	}
+	delete [] cellFill;
+}
+
+/**
+ PolygonTrigger::freeIndex - Releases the grid of trigger bounds.
+*/
+void PolygonTrigger::freeIndex()
+{
+	delete [] s_indexCellStart;
+	s_indexCellStart = nullptr;
+	delete [] s_indexCellTriggers;
+	s_indexCellTriggers = nullptr;
+	s_indexCellsX = 0;
+	s_indexCellsY = 0;
+}
+
+/**
+ PolygonTrigger::getPolygonTriggerCandidates - Gets the triggers whose bounds overlap the grid
+ cell containing point, in list order.  Callers still need pointInTrigger for the exact test.
+*/
+Int PolygonTrigger::getPolygonTriggerCandidates(const ICoord3D &point, PolygonTrigger * const *&candidates)
+{
+	if (s_indexNeedsUpdate) {
+		updateIndex();
+	}
+	candidates = nullptr;
+	if (s_indexCellsX == 0) {
+		return 0;
+	}
+	Int x = point.x - s_indexOrigin.x;
+	Int y = point.y - s_indexOrigin.y;
+	if (x < 0 || y < 0) {
+		return 0;
+	}
+	x /= s_indexCellSize;
+	y /= s_indexCellSize;
+	if (x >= s_indexCellsX || y >= s_indexCellsY) {
+		return 0;
+	}
+	Int cell = y*s_indexCellsX + x;
+	candidates = s_indexCellTriggers + s_indexCellStart[cell];
+	return s_indexCellStart[cell+1] - s_indexCellStart[cell];
+}
+
 
 /**
  PolygonTrigger::addPolygonTrigger adds a trigger to the list of triggers.
@@ -301,6 +428,7 @@ void PolygonTrigger::addPolygonTrigger(PolygonTrigger *pTrigger)
 	}
 	pTrigger->m_nextPolygonTrigger = ThePolygonTriggerListPtr;
 	ThePolygonTriggerListPtr = pTrigger;
+	s_indexNeedsUpdate = true;
 }
 
 /**
@@ -326,6 +454,7 @@ void PolygonTrigger::removePolygonTrigger(PolygonTrigger *pTrigger)
 		}
 	}
 	pTrigger->m_nextPolygonTrigger = nullptr;
+	s_indexNeedsUpdate = true;
 }
 
 /**
@@ -336,6 +465,8 @@ void PolygonTrigger::deleteTriggers()
 	PolygonTrigger *pList = ThePolygonTriggerListPtr;
 	ThePolygonTriggerListPtr = nullptr;
 	s_currentID = 1;
+	freeIndex();
+	s_indexNeedsUpdate = true;
 	deleteInstance(pList);
 }
 
@@ -353,6 +484,7 @@ void PolygonTrigger::addPoint(const ICoord3D &point)
 	m_points[m_numPoints] = point;
 	m_numPoints++;
 	m_boundsNeedsUpdate = true;
+	s_indexNeedsUpdate = true;
 }
 
 /**
@@ -371,6 +503,9 @@ void PolygonTrigger::setPoint(const ICoord3D &point, Int ndx)
 	if (ndx>m_numPoints) { // Can't skip points.
 		return;
 	}
+	if (m_points[ndx].x != point.x || m_points[ndx].y != point.y) {
+		s_indexNeedsUpdate = true; // water height changes only move z.
+	}
 	m_points[ndx] = point;
 	m_boundsNeedsUpdate = true;
 }
@@ -398,6 +533,7 @@ void PolygonTrigger::insertPoint(const ICoord3D &point, Int ndx)
 	m_points[ndx] = point;
 	m_numPoints++;
 	m_boundsNeedsUpdate = true;
+	s_indexNeedsUpdate = true;
 }
 
 /**
@@ -415,6 +551,7 @@ void PolygonTrigger::deletePoint(Int ndx)
 	}
 	m_numPoints--;
 	m_boundsNeedsUpdate = true;
+	s_indexNeedsUpdate = true;
 }
 
 void PolygonTrigger::getCenterPoint(Coord3D* pOutCoord)	const
@@ -549,6 +686,9 @@ void PolygonTrigger::xfer( Xfer *xfer )
 	// bounds need update
 	xfer->xferBool( &m_boundsNeedsUpdate );
 
+	if( xfer->getXferMode() == XFER_LOAD )
+		s_indexNeedsUpdate = true;
+
 }
 
 // ------------------------------------------------------------------------------------------------
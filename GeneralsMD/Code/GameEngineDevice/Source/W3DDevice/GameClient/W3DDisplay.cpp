@@ -42,6 +42,7 @@ static void drawFramerateBar();
 
 // USER INCLUDES //////////////////////////////////////////////////////////////
 #include "Common/FramePacer.h"
+#include "Common/GameEngine.h"
 #include "Common/ThingFactory.h"
 #include "Common/GlobalData.h"
 #include "Common/PerfTimer.h"
@@ -282,6 +283,10 @@ void StatDumpClass::dumpStats( Bool brief, Bool flagSpikes )
 	fprintf( m_fp, "  Particle Systems: %d\n", TheParticleSystemManager->getParticleSystemCount() );
 	Int totalParticles = TheParticleSystemManager->getParticleCount();
 	fprintf( m_fp, "  Particles: %d in world (%d onscreen)\n", totalParticles, onScreenParticleCount );
+	fprintf( m_fp, "  Particle update time last frame: %.5f msec (%d worker threads)\n",
+		TheParticleSystemManager->getUpdateTimeLastFrame()*1000, TheParticleSystemManager->getUpdateThreadCount() );
+	fprintf( m_fp, "  Client update time last frame: %.5f msec, logic update time last frame: %.5f msec\n",
+		TheGameEngine->getClientUpdateTimeLastFrame()*1000, TheGameEngine->getLogicUpdateTimeLastFrame()*1000 );
 
   if ( flagSpikes && totalParticles > TheGlobalData->m_maxParticleCount - 10 )
   	fprintf( m_fp, "                                                                      PARTICLES OUT OF TOLERANCE(CAP-10)\n" );
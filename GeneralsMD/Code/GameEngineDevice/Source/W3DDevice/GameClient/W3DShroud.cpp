@@ -83,6 +83,7 @@ W3DShroud::W3DShroud()
 	m_dstTextureHeight=m_numMaxVisibleCellsY=0;
 	m_boderShroudLevel = (W3DShroudLevel)TheGlobalData->m_shroudAlpha;	//assume border is black
 	m_clearDstTexture = TRUE;	//force clearing of destination texture;
+	m_dirtyRect.left = m_dirtyRect.top = m_dirtyRect.right = m_dirtyRect.bottom = 0;
 
 	m_cellWidth=DEFAULT_SHROUD_CELL_SIZE;
 	m_cellHeight=DEFAULT_SHROUD_CELL_SIZE;
@@ -181,6 +182,7 @@ void W3DShroud::init(WorldHeightMap *pMap, Real worldCellSizeX, Real worldCellSi
 
 	//clear entire texture to black
 	memset(m_srcTextureData,0,m_srcTexturePitch*srcHeight);
+	setAllDirty();
 
 #if defined(RTS_DEBUG)
 	if (TheGlobalData && TheGlobalData->m_fogOfWarOn)
@@ -296,6 +298,8 @@ void W3DShroud::setShroudLevel(Int x, Int y, W3DShroudLevel level, Bool textureO
 		if (level < TheGlobalData->m_shroudAlpha)
 			level = TheGlobalData->m_shroudAlpha;
 
+		addDirtyCell(x, y);
+
 #if defined(RTS_DEBUG)
 		if (TheGlobalData && TheGlobalData->m_fogOfWarOn)
 		{
@@ -402,6 +406,7 @@ void W3DShroud::fillShroudData(W3DShroudLevel level)
 			ptr[x]=pixel;
 		ptr	+= pitch;
 	}
+	setAllDirty();
 
 #ifdef DO_FOG_INTERPOLATION
 	//Set the final shroud state.  May differe from current state because of time interpolation.
@@ -506,6 +511,37 @@ void W3DShroud::fillBorderShroudData(W3DShroudLevel level, SurfaceClass* pDestSu
 
 }
 
+//-----------------------------------------------------------------------------
+void W3DShroud::addDirtyCell(Int x, Int y)
+{
+	if (m_dirtyRect.left >= m_dirtyRect.right)
+	{
+		m_dirtyRect.left = x;
+		m_dirtyRect.top = y;
+		m_dirtyRect.right = x + 1;
+		m_dirtyRect.bottom = y + 1;
+		return;
+	}
+
+	if (x < m_dirtyRect.left)
+		m_dirtyRect.left = x;
+	if (y < m_dirtyRect.top)
+		m_dirtyRect.top = y;
+	if (x >= m_dirtyRect.right)
+		m_dirtyRect.right = x + 1;
+	if (y >= m_dirtyRect.bottom)
+		m_dirtyRect.bottom = y + 1;
+}
+
+//-----------------------------------------------------------------------------
+void W3DShroud::setAllDirty()
+{
+	m_dirtyRect.left = 0;
+	m_dirtyRect.top = 0;
+	m_dirtyRect.right = m_numCellsX;
+	m_dirtyRect.bottom = m_numCellsY;
+}
+
 /**Set the shroud color within the border area of the map*/
 void W3DShroud::setBorderShroudLevel(W3DShroudLevel level)
 {
@@ -710,8 +746,26 @@ void W3DShroud::render(CameraClass *cam)
 		m_clearDstTexture=FALSE;
 
 		fillBorderShroudData(m_boderShroudLevel, pDestSurface);
+		setAllDirty();	//the border fill covers the whole destination texture
 	}
 
+#ifndef DO_FOG_INTERPOLATION
+	// Ronin @performance 16/10/2026 The destination texture keeps its contents between frames,
+	// so only the cells that changed since the last copy need to go to video memory.
+	if (m_dirtyRect.left > srcRect.left)
+		srcRect.left = m_dirtyRect.left;
+	if (m_dirtyRect.top > srcRect.top)
+		srcRect.top = m_dirtyRect.top;
+	if (m_dirtyRect.right < srcRect.right)
+		srcRect.right = m_dirtyRect.right;
+	if (m_dirtyRect.bottom < srcRect.bottom)
+		srcRect.bottom = m_dirtyRect.bottom;
+	dstPoint.x += srcRect.left - visStartX;
+	dstPoint.y += srcRect.top - visStartY;
+#endif
+	m_dirtyRect.left = m_dirtyRect.top = m_dirtyRect.right = m_dirtyRect.bottom = 0;
+
+	if (srcRect.left < srcRect.right && srcRect.top < srcRect.bottom)
 	{
 		//USE_PERF_TIMER(shroudCopy)
 		DX8Wrapper::_Copy_DX8_Rects(